@@ -0,0 +1,187 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// The clipper, optionally oversampled, with three curves. Output never
+// exceeds the threshold at the processing rate.
+//
+//   Hard      clamp to +-threshold
+//   SoftKnee  quadratic knee from threshold - w to threshold + w (w = knee *
+//             threshold): unity slope below, flat at threshold above, no
+//             corner for the harmonics to ring from
+//   Adaa      hard clip with first-order antiderivative anti-aliasing: each
+//             output is the mean of the clamp between consecutive inputs,
+//             (F(x[n]) - F(x[n-1])) / (x[n] - x[n-1]) with F the clamp's
+//             antiderivative (half a sample of delay at the processing rate;
+//             below the threshold that mean is a two-sample average, which
+//             softens the top octave at 1x - best used oversampled)
+//
+// Oversampling: 2x, 4x or 8x polyphase IIR half-band (juce::dsp::Oversampling,
+// integer latency). All three are built in prepare(), so switching on the
+// audio thread never allocates; getLatencySamples(curve) is the active factor's
+// plus, for Adaa, its half sample at the processing rate (fractional).
+// The curves run over contiguous samples at the processing rate without
+// branches (Adaa reads only inputs, not outputs), so they vectorise.
+class ClipStage
+{
+public:
+    enum class Curve { Hard, SoftKnee, Adaa };  // Parameter-choice order
+
+    static constexpr int maxOversamplingFactor = 3;  // 2^3 = 8x
+    static constexpr float knee = 0.2f;
+
+    // Message thread, audio stopped (allocates)
+    void prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        const auto numChannels = juce::jmax(1u, spec.numChannels);
+
+        for (size_t i = 0; i < oversamplers.size(); ++i)
+        {
+            auto& stage = oversamplers[i];
+            stage = std::make_unique<juce::dsp::Oversampling<float>>(numChannels, i + 1,
+                                                                     juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+                                                                     true, true);
+            stage->initProcessing(static_cast<size_t>(spec.maximumBlockSize));
+        }
+
+        previousInput.assign(numChannels, 0.0f);
+        scratch.assign((static_cast<size_t>(spec.maximumBlockSize) << maxOversamplingFactor) + 1, 0.0f);
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& stage : oversamplers)
+            if (stage != nullptr)
+                stage->reset();
+
+        std::fill(previousInput.begin(), previousInput.end(), 0.0f);
+    }
+
+    // Audio thread: 0 = off, 1 = 2x .. 3 = 8x. The incoming path starts clean.
+    void setOversamplingFactor(int newFactor)
+    {
+        newFactor = juce::jlimit(0, maxOversamplingFactor, newFactor);
+
+        if (newFactor == factor)
+            return;
+
+        factor = newFactor;
+        reset();
+    }
+
+    int getOversamplingFactor() const { return factor; }
+
+    float getLatencySamples(Curve curve) const
+    {
+        const float curveLatency = curve == Curve::Adaa ? 0.5f / static_cast<float>(1 << factor) : 0.0f;
+        return static_cast<float>(getLatencySamples(factor)) + curveLatency;
+    }
+
+    // Oversampler only
+    int getLatencySamples(int forFactor) const
+    {
+        if (forFactor == 0 || oversamplers[0] == nullptr)
+            return 0;
+
+        return juce::roundToInt(oversamplers[static_cast<size_t>(forFactor - 1)]->getLatencyInSamples());
+    }
+
+    // Audio thread, in place
+    void process(juce::dsp::AudioBlock<float>& block, float threshold, Curve curve)
+    {
+        if (factor == 0)
+        {
+            processChannels(block, threshold, curve);
+            return;
+        }
+
+        auto& oversampler = *oversamplers[static_cast<size_t>(factor - 1)];
+        auto oversampledBlock = oversampler.processSamplesUp(block);
+        processChannels(oversampledBlock, threshold, curve);
+        oversampler.processSamplesDown(block);
+    }
+
+private:
+    void processChannels(juce::dsp::AudioBlock<float>& block, float threshold, Curve curve)
+    {
+        const auto numChannels = juce::jmin(block.getNumChannels(), previousInput.size());
+        const int numSamples = static_cast<int>(block.getNumSamples());
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+        {
+            float* samples = block.getChannelPointer(ch);
+
+            switch (curve)
+            {
+                case Curve::Hard:     processHard(samples, numSamples, threshold); break;
+                case Curve::SoftKnee: processSoftKnee(samples, numSamples, threshold); break;
+                case Curve::Adaa:     processAdaa(samples, numSamples, threshold, previousInput[ch]); break;
+            }
+        }
+    }
+
+    static void processHard(float* samples, int numSamples, float threshold)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            samples[i] = juce::jlimit(-threshold, threshold, samples[i]);
+    }
+
+    static void processSoftKnee(float* samples, int numSamples, float threshold)
+    {
+        const float width = knee * threshold;
+
+        if (width <= 0.0f)
+        {
+            processHard(samples, numSamples, threshold);
+            return;
+        }
+
+        const float start = threshold - width;
+        const float curvature = 0.25f / width;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float a = juce::jmin(std::abs(samples[i]), threshold + width);
+            const float over = juce::jmax(0.0f, a - start);
+            samples[i] = std::copysign(a - curvature * over * over, samples[i]);
+        }
+    }
+
+    // Mean of the clamp over [x[n-1], x[n]]. Double for the divided
+    // difference; near-equal inputs use the clamped midpoint instead.
+    void processAdaa(float* samples, int numSamples, float threshold, float& previous)
+    {
+        const double t = threshold;
+        const auto antiderivative = [t](double x)
+        {
+            const double a = std::abs(x);
+            return a <= t ? 0.5 * x * x : t * a - 0.5 * t * t;
+        };
+
+        // Keep the inputs: the loop reads x[n-1] after x[n-1] has been replaced
+        float* inputs = scratch.data();
+        inputs[0] = previous;
+        std::copy(samples, samples + numSamples, inputs + 1);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double x0 = inputs[i];
+            const double x1 = inputs[i + 1];
+            const double dx = x1 - x0;
+            const double mean = std::abs(dx) < 1.0e-6 ? juce::jlimit(-t, t, 0.5 * (x0 + x1))
+                                                      : (antiderivative(x1) - antiderivative(x0)) / dx;
+            samples[i] = static_cast<float>(mean);
+        }
+
+        previous = inputs[numSamples];
+    }
+
+    int factor = 0;
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, maxOversamplingFactor> oversamplers;  // 2x, 4x, 8x
+    std::vector<float> previousInput;  // Adaa: last input per channel
+    std::vector<float> scratch;        // Adaa: x[n-1] followed by the block's inputs
+};
@@ -0,0 +1,163 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Sample-accurate lookahead peak envelope: the core of a lookahead limiter.
+//
+// The audio is delayed by the lookahead; alongside every delayed sample comes
+// an envelope value that is never below that sample's (stereo-linked) peak, so
+// gain = ceiling / envelope keeps it at or under the ceiling.
+//
+//   1. Detection: the louder channel's |x| drives both channels (stereo link),
+//      or caller-supplied levels (e.g. pfs::TruePeakDetector) aligned with
+//      the incoming samples.
+//   2. Sliding maximum over the window (incoming sample + lookahead) with a
+//      monotonic deque: O(1) amortised per sample, whatever the lookahead.
+//   3. Instant rise, one-pole release.
+//   4. Attack: moving average over the same window, so the envelope ramps up
+//      across the lookahead and has reached each peak when it leaves the delay.
+//
+// Latency is getLatencySamples(). No allocation after prepare().
+class LookaheadLimiter
+{
+public:
+    static constexpr int maxChannels = 2;
+
+    // Message thread, audio stopped (allocates)
+    void prepare(double newSampleRate, int newLookaheadSamples)
+    {
+        sampleRate = newSampleRate;
+        lookahead = juce::jmax(1, newLookaheadSamples);
+        window = lookahead + 1;
+
+        for (auto& delay : delays)
+            delay.assign(static_cast<size_t>(lookahead), 0.0f);
+
+        levelDelay.assign(static_cast<size_t>(lookahead), 0.0f);
+        dequeIndices.assign(static_cast<size_t>(window), 0);
+        dequeValues.assign(static_cast<size_t>(window), 0.0f);
+        attackRing.assign(static_cast<size_t>(window), 0.0f);
+
+        setReleaseTime(releaseSeconds);
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& delay : delays)
+            std::fill(delay.begin(), delay.end(), 0.0f);
+
+        std::fill(levelDelay.begin(), levelDelay.end(), 0.0f);
+        std::fill(attackRing.begin(), attackRing.end(), 0.0f);
+        delayPosition = attackPosition = 0;
+        dequeFront = dequeSize = 0;
+        sampleIndex = 0;
+        held = 0.0f;
+        attackSum = 0.0;
+    }
+
+    void setReleaseTime(double seconds)
+    {
+        releaseSeconds = seconds;
+        release = seconds > 0.0 ? static_cast<float>(1.0 - std::exp(-1.0 / (seconds * sampleRate))) : 1.0f;
+    }
+
+    int getLatencySamples() const { return lookahead; }
+
+    // Audio thread: delays the buffer in place by the lookahead and writes the
+    // envelope for each delayed sample into envelope[0 .. numSamples).
+    // levels (optional) replaces the |x| detection of the incoming samples.
+    void process(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float* envelope,
+                 const float* levels = nullptr)
+    {
+        const int numChannels = juce::jmin(buffer.getNumChannels(), maxChannels);
+        std::array<float*, maxChannels> channels {};
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            channels[static_cast<size_t>(ch)] = buffer.getWritePointer(ch, startSample);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float level = 0.0f;
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                float& sample = channels[static_cast<size_t>(ch)][i];
+                level = juce::jmax(level, std::abs(sample));
+                std::swap(sample, delays[static_cast<size_t>(ch)][static_cast<size_t>(delayPosition)]);
+            }
+
+            if (levels != nullptr)
+                level = levels[i];
+
+            // Level of the sample leaving the delay, for the rounding guard below
+            const float delayedLevel = levelDelay[static_cast<size_t>(delayPosition)];
+            levelDelay[static_cast<size_t>(delayPosition)] = level;
+            delayPosition = delayPosition + 1 == lookahead ? 0 : delayPosition + 1;
+
+            const float peak = pushSlidingMaximum(level);
+            held = peak >= held ? peak : held + release * (peak - held);
+
+            attackSum += held - attackRing[static_cast<size_t>(attackPosition)];
+            attackRing[static_cast<size_t>(attackPosition)] = held;
+            attackPosition = attackPosition + 1 == window ? 0 : attackPosition + 1;
+
+            // The average is already >= the delayed level; the max only absorbs
+            // rounding in the running sum
+            envelope[i] = juce::jmax(static_cast<float>(attackSum / window), delayedLevel);
+        }
+    }
+
+private:
+    // Monotonic deque (values decreasing front to back) in a ring of `window`
+    // entries; returns the maximum of the last `window` levels
+    float pushSlidingMaximum(float level)
+    {
+        // Drop the entry leaving the window first, so the ring never overfills
+        if (dequeSize > 0 && dequeIndices[static_cast<size_t>(dequeFront)] + window <= sampleIndex)
+        {
+            dequeFront = dequeSlot(1);
+            --dequeSize;
+        }
+
+        while (dequeSize > 0 && dequeValues[static_cast<size_t>(dequeSlot(dequeSize - 1))] <= level)
+            --dequeSize;
+
+        const auto back = static_cast<size_t>(dequeSlot(dequeSize++));
+        dequeIndices[back] = sampleIndex;
+        dequeValues[back] = level;
+
+        ++sampleIndex;
+        return dequeValues[static_cast<size_t>(dequeFront)];
+    }
+
+    int dequeSlot(int offset) const
+    {
+        const int slot = dequeFront + offset;
+        return slot >= window ? slot - window : slot;
+    }
+
+    double sampleRate = 44100.0;
+    int lookahead = 1;
+    int window = 2;
+
+    std::array<std::vector<float>, maxChannels> delays;
+    std::vector<float> levelDelay;  // Detected levels, delayed alongside the audio
+    int delayPosition = 0;
+
+    std::vector<juce::int64> dequeIndices;
+    std::vector<float> dequeValues;
+    int dequeFront = 0;
+    int dequeSize = 0;
+    juce::int64 sampleIndex = 0;
+
+    double releaseSeconds = 0.05;
+    float release = 1.0f;
+    float held = 0.0f;
+
+    std::vector<float> attackRing;
+    int attackPosition = 0;
+    double attackSum = 0.0;
+};
@@ -112,25 +112,20 @@ void AutoClipAudioProcessorEditor::timerCallback()
     float clipThresholdPercent = clipThresholdParam->load();
     float clipThreshold = clipThresholdPercent * 0.01f;  // Convert 0-100% to 0.0-1.0
 
-    // Simple peak detection from last processed buffer
-    // Note: Real implementation would use atomic<float> in processor for thread-safe access
-    // For now, use smoothed approximation based on parameters
-
-    // Estimate input peak (assume normalized signal)
-    float estimatedInputPeak = 0.7f;  // Placeholder - would read from processor
-
-    // Estimate output peak (if clipping, output clamped to threshold)
-    float estimatedOutputPeak = (clipThreshold > 0.01f && clipThreshold < 1.0f)
-                                ? clipThreshold
-                                : estimatedInputPeak;
+    // Highest peaks since the last frame, from the processor's meters
+    const auto input = processorRef.getInputMeter().readSince(inputMeterPosition);
+    const auto output = processorRef.getOutputMeter().readSince(outputMeterPosition);
+    const float inputPeak = juce::Decibels::decibelsToGain(input.truePeakDb, pfs::MeterReading::minimumDb);
+    const float outputPeak = juce::Decibels::decibelsToGain(output.truePeakDb, pfs::MeterReading::minimumDb);
 
     // Smooth peaks for visual stability (exponential smoothing)
     const float smoothingFactor = 0.3f;
-    smoothedInputPeak += (estimatedInputPeak - smoothedInputPeak) * smoothingFactor;
-    smoothedOutputPeak += (estimatedOutputPeak - smoothedOutputPeak) * smoothingFactor;
+    smoothedInputPeak += (inputPeak - smoothedInputPeak) * smoothingFactor;
+    smoothedOutputPeak += (outputPeak - smoothedOutputPeak) * smoothingFactor;
 
-    // Detect clipping (occurs when threshold < 1.0 and signal would exceed it)
-    bool isClipping = (clipThreshold < 0.99f && estimatedInputPeak > clipThreshold);
+    // Detect clipping (occurs when threshold < 1.0 and an input sample exceeded it)
+    bool isClipping = (clipThreshold < 0.99f
+                       && input.samplePeakDb > juce::Decibels::gainToDecibels(clipThreshold, pfs::MeterReading::minimumDb));
 
     // Send meter data to JavaScript via custom event
     // JavaScript listens for 'meterUpdate' event
@@ -37,6 +37,8 @@ private:
     void timerCallback() override;
     float smoothedInputPeak = 0.0f;
     float smoothedOutputPeak = 0.0f;
+    juce::uint64 inputMeterPosition = 0;   // Read cursors into the processor's meter histories
+    juce::uint64 outputMeterPosition = 0;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoClipAudioProcessorEditor)
 };
@@ -24,6 +24,31 @@ juce::AudioProcessorValueTreeState::ParameterLayout AutoClipAudioProcessor::crea
         false
     ));
 
+    // clipMode - Choice (Standard = 1x; oversampled modes add a true-peak ceiling)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "clipMode", 1 },
+        "Clip Mode",
+        juce::StringArray { "Standard", "Oversampled 2x", "Oversampled 4x", "Oversampled 8x" },
+        0
+    ));
+
+    // clipCurve - Choice (default: Hard)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "clipCurve", 1 },
+        "Clip Curve",
+        juce::StringArray { "Hard", "Soft Knee", "ADAA" },
+        0
+    ));
+
+    // ceiling - Float (-12 to 0 dBTP, default -1): output true-peak ceiling in oversampled modes
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "ceiling", 1 },
+        "True Peak Ceiling",
+        juce::NormalisableRange<float>(-12.0f, 0.0f, 0.1f),
+        -1.0f,
+        "dBTP"
+    ));
+
     return layout;
 }
 
@@ -47,33 +72,66 @@ AutoClipAudioProcessor::~AutoClipAudioProcessor()
 //==============================================================================
 void AutoClipAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Phase 4.1: Prepare lookahead delay lines (5ms fixed delay)
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
-
-    lookaheadSamples = static_cast<int>(0.005 * sampleRate);  // 5ms in samples
-
-    lookaheadDelayL.prepare(spec);
-    lookaheadDelayR.prepare(spec);
-    lookaheadDelayL.setMaximumDelayInSamples(lookaheadSamples);
-    lookaheadDelayR.setMaximumDelayInSamples(lookaheadSamples);
-    lookaheadDelayL.reset();
-    lookaheadDelayR.reset();
-
-    // Phase 4.2: Prepare gain smoothing (50ms time constant)
-    smoothedGain.reset(sampleRate, 0.05);  // 50ms smoothing
-    smoothedGain.setCurrentAndTargetValue(1.0f);  // Default gain = 1.0
-
-    // Phase 4.3: Preallocate original buffer for clip solo
-    originalBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
-    originalBuffer.clear();
+    const int numChannels = getTotalNumOutputChannels();
+    const int chunkSize = juce::jmax(1, samplesPerBlock);
+
+    // Phase 4.1: Prepare the lookahead (5ms fixed delay); the reported latency
+    // (updateClipMode) keeps the clipped track in phase with parallel copies
+    lookahead.prepare(sampleRate, static_cast<int>(0.005 * sampleRate));
+
+    // Phase 4.2: Gain matching follows the envelope (50ms release, attack
+    // across the lookahead)
+    lookahead.setReleaseTime(0.05);
+    peakEnvelope.assign(static_cast<size_t>(chunkSize), 0.0f);
+
+    // Clip stage: every oversampling factor is built here, so clipMode can
+    // change without allocating
+    juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32>(chunkSize), static_cast<juce::uint32>(numChannels) };
+    clipper.prepare(spec);
+
+    juce::dsp::ProcessSpec alignmentSpec { sampleRate, spec.maximumBlockSize, spec.numChannels + 1 };
+    alignmentDelay.prepare(alignmentSpec);
+    alignmentDelay.setMaximumDelayInSamples(clipper.getLatencySamples(ClipStage::maxOversamplingFactor) + 1);  // + Adaa's half sample
+    dryBuffer.setSize(numChannels, chunkSize);
+
+    // True-peak ceiling
+    ceilingDetector.prepare(numChannels);
+    ceilingLimiter.prepare(sampleRate, static_cast<int>(0.002 * sampleRate));
+    ceilingLimiter.setReleaseTime(0.1);
+    truePeakLevels.assign(static_cast<size_t>(chunkSize), 0.0f);
+    ceilingEnvelope.assign(static_cast<size_t>(chunkSize), 0.0f);
+
+    updateClipMode();
+
+    // Phase 5.3: Input and output meters (the editor shows true and sample peaks only)
+    inputMeter.prepare(sampleRate, getTotalNumInputChannels(), pfs::LevelMeter::Measurements::peaksOnly);
+    outputMeter.prepare(sampleRate, numChannels, pfs::LevelMeter::Measurements::peaksOnly);
+}
+
+void AutoClipAudioProcessor::updateClipMode()
+{
+    clipper.setOversamplingFactor(static_cast<int>(parameters.getRawParameterValue("clipMode")->load()));
+
+    const auto curve = static_cast<ClipStage::Curve>(static_cast<int>(parameters.getRawParameterValue("clipCurve")->load()));
+    const float clipLatency = clipper.getLatencySamples(curve);
+    const bool oversampled = clipper.getOversamplingFactor() > 0;
+
+    // Restart the alignment and ceiling state when the mode (and latency) changes
+    if (! juce::approximatelyEqual(clipLatency, alignmentDelay.getDelay()))
+    {
+        alignmentDelay.setDelay(clipLatency);
+        alignmentDelay.reset();
+        ceilingDetector.reset();
+        ceilingLimiter.reset();
+    }
+
+    // Lookahead + oversampler + (oversampled modes) true-peak detection and ceiling lookahead
+    const int ceilingLatency = oversampled ? pfs::TruePeakDetector::delaySamples + ceilingLimiter.getLatencySamples() : 0;
+    setLatencySamples(lookahead.getLatencySamples() + juce::roundToInt(clipLatency) + ceilingLatency);
 }
 
 void AutoClipAudioProcessor::releaseResources()
 {
-    // Release large buffers to save memory when plugin not in use
-    originalBuffer.setSize(0, 0);
 }
 
 void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -89,83 +147,103 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     auto* soloClippedParam = parameters.getRawParameterValue("soloClipped");
     bool soloClipped = soloClippedParam->load() > 0.5f;
 
-    const int numSamples = buffer.getNumSamples();
-    const int numChannels = buffer.getNumChannels();
+    const auto curve = static_cast<ClipStage::Curve>(static_cast<int>(parameters.getRawParameterValue("clipCurve")->load()));
 
-    // Phase 4.3: Store original signal before processing
-    originalBuffer.setSize(numChannels, numSamples, false, false, true);
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        originalBuffer.copyFrom(channel, 0, buffer, channel, 0, numSamples);
-    }
+    // Slightly inside the ceiling: the gain moves across the interpolator's
+    // span, which the metered true peak would otherwise overshoot by ~0.01 dB
+    const float ceilingGain = 0.998f * juce::Decibels::decibelsToGain(parameters.getRawParameterValue("ceiling")->load());
 
-    // Phase 4.1 & 4.2: Process each channel
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
-        auto& delayLine = (channel == 0) ? lookaheadDelayL : lookaheadDelayR;
+    updateClipMode();
+    const bool oversampled = clipper.getOversamplingFactor() > 0;
+    const float clipLatency = clipper.getLatencySamples(curve);
 
-        // Reset peak detectors for this block
-        inputPeak = 0.0f;
-        outputPeak = 0.0f;
+    const int numSamples = buffer.getNumSamples();
+    const int numChannels = juce::jmin(buffer.getNumChannels(), dryBuffer.getNumChannels());
 
-        // Process sample by sample
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            // Phase 4.1: Push input to lookahead buffer
-            delayLine.pushSample(channel, channelData[sample]);
+    // Phase 5.3: Meter the input as it arrives
+    inputMeter.process(buffer);
 
-            // Phase 4.2: Analyze input peak from lookahead buffer (before clipping)
-            // Get delayed sample from lookahead
-            float delayedSample = delayLine.popSample(channel, lookaheadSamples);
-            inputPeak = juce::jmax(inputPeak, std::abs(delayedSample));
+    // In chunks of the prepared block size (hosts may exceed it)
+    const int chunkSize = static_cast<int>(peakEnvelope.size());
 
-            // Phase 4.1: Apply hard clipping
-            float clippedSample = juce::jlimit(-clipThreshold, clipThreshold, delayedSample);
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int count = juce::jmin(chunkSize, numSamples - start);
+        float* gain = peakEnvelope.data();
 
-            // Phase 4.2: Analyze output peak from clipped signal
-            outputPeak = juce::jmax(outputPeak, std::abs(clippedSample));
+        // Phase 4.1: Delay through the lookahead; envelope[i] >= the stereo
+        // peak of delayed sample i, reaching each peak as it arrives
+        lookahead.process(buffer, start, count, gain);
 
-            // Store clipped sample (will apply gain in second pass)
-            channelData[sample] = clippedSample;
+        // Phase 4.2: Gain matching per sample - restore the clipped peak,
+        // min(envelope, threshold), to the input peak
+        for (int i = 0; i < count; ++i)
+        {
+            const float envelope = gain[i];
+            gain[i] = (clipThreshold > 0.001f && envelope > 0.001f) ? juce::jmax(1.0f, envelope / clipThreshold) : 1.0f;
         }
-    }
-
-    // Phase 4.2: Calculate gain compensation (after analyzing all channels)
-    float targetGain = 1.0f;
-    if (outputPeak > 0.001f && inputPeak > 0.001f)
-    {
-        targetGain = inputPeak / outputPeak;  // Restore to input peak level
-    }
-    smoothedGain.setTargetValue(targetGain);
 
-    // Apply smoothed gain to all channels
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        auto* channelData = buffer.getWritePointer(channel);
+        // Dry signal and gain, delayed to line up with the clip stage output
+        for (int channel = 0; channel < numChannels; ++channel)
+            dryBuffer.copyFrom(channel, 0, buffer, channel, start, count);
 
-        for (int sample = 0; sample < numSamples; ++sample)
+        if (clipLatency > 0.0f)
         {
-            float currentGain = smoothedGain.getNextValue();
-            channelData[sample] *= currentGain;
+            for (int i = 0; i < count; ++i)
+            {
+                for (int channel = 0; channel < numChannels; ++channel)
+                {
+                    alignmentDelay.pushSample(channel, dryBuffer.getSample(channel, i));
+                    dryBuffer.setSample(channel, i, alignmentDelay.popSample(channel));
+                }
+
+                alignmentDelay.pushSample(numChannels, gain[i]);
+                gain[i] = alignmentDelay.popSample(numChannels);
+            }
         }
-    }
 
-    // Phase 4.3: Clip solo routing (output difference signal if enabled)
-    if (soloClipped)
-    {
+        // Phase 4.1: Clip (oversampled and/or ADAA per clipMode/clipCurve)
+        auto block = juce::dsp::AudioBlock<float>(buffer).getSubBlock(static_cast<size_t>(start), static_cast<size_t>(count));
+        clipper.process(block, clipThreshold, curve);
+
         for (int channel = 0; channel < numChannels; ++channel)
         {
-            auto* outputData = buffer.getWritePointer(channel);
-            auto* originalData = originalBuffer.getReadPointer(channel);
+            auto* channelData = buffer.getWritePointer(channel, start);
+            const auto* dryData = dryBuffer.getReadPointer(channel);
 
-            for (int sample = 0; sample < numSamples; ++sample)
+            for (int i = 0; i < count; ++i)
             {
-                // Difference signal = original - clipped_with_gain
-                outputData[sample] = originalData[sample] - outputData[sample];
+                // Phase 4.2: The matching gain on the clipped signal
+                const float output = channelData[i] * gain[i];
+
+                // Phase 4.3: Clip solo outputs the difference signal (original -
+                // clipped_with_gain), time-aligned through the same delays
+                channelData[i] = soloClipped ? dryData[i] - output : output;
             }
         }
+
+        // True-peak ceiling (oversampled modes): the output's 4x-interpolated
+        // peaks stay at or under the ceiling
+        if (oversampled)
+        {
+            std::array<float*, LookaheadLimiter::maxChannels> channels {};
+
+            for (int channel = 0; channel < juce::jmin(numChannels, LookaheadLimiter::maxChannels); ++channel)
+                channels[static_cast<size_t>(channel)] = buffer.getWritePointer(channel, start);
+
+            ceilingDetector.process(channels.data(), juce::jmin(numChannels, LookaheadLimiter::maxChannels), count, truePeakLevels.data());
+            ceilingLimiter.process(buffer, start, count, ceilingEnvelope.data(), truePeakLevels.data());
+
+            for (int i = 0; i < count; ++i)
+                ceilingEnvelope[static_cast<size_t>(i)] = juce::jmin(1.0f, ceilingGain / juce::jmax(ceilingEnvelope[static_cast<size_t>(i)], 1.0e-9f));
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                juce::FloatVectorOperations::multiply(buffer.getWritePointer(channel, start), ceilingEnvelope.data(), count);
+        }
     }
+
+    // Phase 5.3: Meter what leaves the plugin
+    outputMeter.process(buffer);
 }
 
 //==============================================================================
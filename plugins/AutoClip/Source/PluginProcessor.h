@@ -1,6 +1,11 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "ClipStage.h"
+#include "LevelMeter.h"
+#include "LookaheadLimiter.h"
+#include "TruePeak.h"
+#include <vector>
 
 class AutoClipAudioProcessor : public juce::AudioProcessor
 {
@@ -33,23 +38,41 @@ public:
     // Public APVTS for editor binding
     juce::AudioProcessorValueTreeState parameters;
 
+    // Phase 5.3: Metering (lock-free histories, read at the editor's frame rate)
+    const pfs::LevelMeter& getInputMeter() const { return inputMeter; }
+    const pfs::LevelMeter& getOutputMeter() const { return outputMeter; }
+
 private:
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     // DSP Components (Phase 4.1: Core Processing)
-    juce::dsp::ProcessSpec spec;
-    juce::dsp::DelayLine<float> lookaheadDelayL { 48000 };  // Max 1 second at 48kHz
-    juce::dsp::DelayLine<float> lookaheadDelayR { 48000 };
-    int lookaheadSamples = 0;
-
-    // Phase 4.2: Automatic Gain Matching
-    juce::SmoothedValue<float> smoothedGain;
-    float inputPeak = 0.0f;
-    float outputPeak = 0.0f;
-
-    // Phase 4.3: Clip Solo (Delta Monitoring)
-    juce::AudioBuffer<float> originalBuffer;
+    // 5ms lookahead (reported to the host) with a sample-accurate stereo-linked
+    // peak envelope; the clip and gain matching run on the delayed signal
+    LookaheadLimiter lookahead;
+    std::vector<float> peakEnvelope;  // Per-sample envelope, then gain (one chunk)
+
+    // Clip modes: Standard (1x) or oversampled 2x/4x/8x with a true-peak
+    // ceiling. Oversampled modes delay the clip by the oversampler latency and
+    // the ADAA curve by half a sample at the processing rate, so the dry signal
+    // (clip solo) and the matching gain are delayed to match. Linear
+    // interpolation: at 1x its half-sample delay is the same two-sample average
+    // the ADAA curve applies below the threshold, so clip solo nulls.
+    ClipStage clipper;
+    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> alignmentDelay;  // L, R, gain
+    juce::AudioBuffer<float> dryBuffer;                                                        // Aligned dry (one chunk)
+
+    // True-peak ceiling (oversampled modes): per-sample 4x true-peak detection
+    // feeding a 2ms lookahead envelope; gain = ceiling / envelope
+    pfs::TruePeakDetector ceilingDetector;
+    LookaheadLimiter ceilingLimiter;
+    std::vector<float> truePeakLevels;  // One chunk
+    std::vector<float> ceilingEnvelope;  // One chunk
+    void updateClipMode();               // Oversampling factor and reported latency from clipMode
+
+    // Phase 5.3: Metering
+    pfs::LevelMeter inputMeter;
+    pfs::LevelMeter outputMeter;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AutoClipAudioProcessor)
 };
@@ -66,8 +66,8 @@ void DriveVerbAudioProcessorEditor::resized()
 
 void DriveVerbAudioProcessorEditor::timerCallback()
 {
-    // Get current drive output level from processor
-    float driveLevelDB = processorRef.getDriveOutputLevel();
+    // Highest drive-output true peak since the last frame (the meter reads down to -60 dB)
+    float driveLevelDB = juce::jmax(-60.0f, processorRef.getDriveMeter().readSince(meterPosition).truePeakDb);
 
     // Send to WebView
     if (webView)
@@ -16,6 +16,7 @@ public:
 
 private:
     DriveVerbAudioProcessor& processorRef;
+    juce::uint64 meterPosition = 0;  // Read cursor into the processor's meter history
 
     // ⚠️ MEMBER DECLARATION ORDER IS CRITICAL (Pattern #11)
     // Members destroyed in REVERSE order of declaration
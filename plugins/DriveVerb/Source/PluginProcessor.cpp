@@ -58,6 +58,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout DriveVerbAudioProcessor::cre
         1.0f
     ));
 
+    // DRIVE QUALITY - Anti-aliasing of the drive stage (default ADAA, no oversampling)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "driveQuality", 1 },
+        "Drive Quality",
+        juce::StringArray { "ADAA", "2x Oversampling", "4x Oversampling" },
+        0
+    ));
+
+    // REVERB MODE - Algorithmic FDN or loaded impulse response (default Algorithmic)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "reverbMode", 1 },
+        "Reverb Mode",
+        juce::StringArray { "Algorithmic", "Impulse Response" },
+        0
+    ));
+
     return layout;
 }
 
@@ -81,26 +97,68 @@ void DriveVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
-    // Prepare reverb
-    reverb.prepare(spec);
+    // Prepare reverb (FDN, and the convolution: rebuilds a loaded IR at the new rate)
+    reverb.prepare(sampleRate, samplesPerBlock, isImpulseResponseSelected());
+    reverb.setDamping(reverbDamping);
+    reverb.setModulation(reverbModulation);
 
     // Prepare dry/wet mixer
     dryWetMixer.prepare(spec);
     dryWetMixer.setMixingRule(juce::dsp::DryWetMixingRule::balanced); // Equal-power mixing
 
-    // Prepare drive waveshaper with tanh transfer function (Stage 4.2)
-    driveShaper.prepare(spec);
-    driveShaper.functionToUse = [](float sample) { return std::tanh(sample); };
+    // Prepare drive stage (Stage 4.2): both oversamplers are built here so the
+    // quality can change during playback without allocating
+    driveStage.prepare(spec);
 
     // Prepare DJ-style filter (Stage 4.3)
     filterProcessor.prepare(spec);
+
+    // Hold covers the longest FDN line so a gap between output echoes is not
+    // mistaken for the end of the tail
+    silence.prepare(sampleRate, 0.25, -120.0f);
+
+    // Drive meter (the VU shows true peak only)
+    driveMeter.prepare(sampleRate, getTotalNumOutputChannels(), pfs::LevelMeter::Measurements::peaksOnly);
+}
+
+double DriveVerbAudioProcessor::getTailLengthSeconds() const
+{
+    // IR mode: the (trimmed) impulse response
+    if (reverb.isUsingImpulseResponse(isImpulseResponseSelected()))
+        return reverb.getImpulseResponseSeconds();
+
+    // Decay is the RT60: two of them take a full-scale tail down to -120 dBFS.
+    // The drive after the reverb lifts the quiet end of the tail by up to its
+    // gain, which takes another (gain dB / 60) RT60s to decay away.
+    const double decaySeconds = parameters.getRawParameterValue("decay")->load();
+    const double driveDb = parameters.getRawParameterValue("drive")->load();
+    return (2.0 + driveDb / 60.0) * decaySeconds + pfs::FdnReverb8::getMaxDelaySeconds();
+}
+
+bool DriveVerbAudioProcessor::isImpulseResponseSelected() const
+{
+    return parameters.getRawParameterValue("reverbMode")->load() > 0.5f;
+}
+
+void DriveVerbAudioProcessor::loadImpulseResponse(const juce::File& file)
+{
+    reverb.loadImpulseResponse(file);
+}
+
+void DriveVerbAudioProcessor::resetTailState()
+{
+    reverb.reset();
+    dryWetMixer.reset();
+    driveStage.reset();
+    filterProcessor.reset();
+    previousWasLowPass = false;
 }
 
 void DriveVerbAudioProcessor::releaseResources()
 {
     reverb.reset();
     dryWetMixer.reset();
-    driveShaper.reset();
+    driveStage.reset();
     filterProcessor.reset();
 }
 
@@ -109,6 +167,16 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
 
+    // Tail sleep: silent input and a finished tail - nothing to run
+    const bool inputActive = ! silence.isBelowThreshold(buffer);
+
+    if (silence.isIdle(inputActive, midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        driveMeter.processSilence(buffer.getNumSamples());
+        return;
+    }
+
     // Get current parameter values (atomic reads, real-time safe)
     auto* sizeParam = parameters.getRawParameterValue("size");
     auto* decayParam = parameters.getRawParameterValue("decay");
@@ -124,21 +192,12 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     float filterValue = filterParam->load();  // -100% to +100%
     bool isPostMode = filterPositionParam->load() > 0.5f;  // false=PRE, true=POST
 
-    // Update reverb parameters
-    juce::dsp::Reverb::Parameters reverbParams;
-    reverbParams.roomSize = sizeValue / 100.0f;  // Normalize to 0-1
-    reverbParams.damping = 0.5f;                  // Fixed for now (could add parameter later)
-    reverbParams.wetLevel = 1.0f;                 // Full wet (dry/wet mixer handles blend)
-    reverbParams.dryLevel = 0.0f;                 // No dry in reverb (dry/wet mixer handles it)
-    reverbParams.width = 1.0f;                    // Full stereo width
-    reverbParams.freezeMode = 0.0f;               // No freeze
-
-    // Map decay time to reverb parameters (decay affects both room size and damping)
-    // Longer decay = larger room + less damping
-    reverbParams.roomSize = juce::jlimit(0.0f, 1.0f, reverbParams.roomSize + (decayValue / 20.0f));
-    reverbParams.damping = juce::jlimit(0.0f, 1.0f, 1.0f - (decayValue / 10.0f));
+    driveStage.setQuality(static_cast<pfs::DriveStage::Quality>(
+        static_cast<int>(parameters.getRawParameterValue("driveQuality")->load())));
 
-    reverb.setParameters(reverbParams);
+    // Update reverb parameters: size scales the delay-line lengths, decay is the RT60
+    reverb.setSize(sizeValue / 100.0f);
+    reverb.setDecaySeconds(decayValue);
 
     // Update dry/wet mix (normalize 0-100% to 0-1)
     dryWetMixer.setWetMixProportion(dryWetValue / 100.0f);
@@ -150,8 +209,8 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     // Push dry signal into mixer
     dryWetMixer.pushDrySamples(block);
 
-    // Process reverb
-    reverb.process(context);
+    // Process reverb (wet only, in place): FDN or impulse response
+    reverb.process(buffer, isImpulseResponseSelected(), isNonRealtime());
 
     // Stage 4.4: PRE/POST routing - apply drive and filter in different orders
     // PRE mode (filterPosition=0.0): Filter → Drive
@@ -160,55 +219,44 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     if (isPostMode)
     {
         // POST MODE: Drive → Filter (drive affects harmonics, then filter shapes them)
-        applyDrive(block, context, driveValue);
+        applyDrive(block, driveValue);
         applyFilter(block, context, filterValue);
     }
     else
     {
         // PRE MODE: Filter → Drive (filter shapes frequency content, then drive adds harmonics)
         applyFilter(block, context, filterValue);
-        applyDrive(block, context, driveValue);
+        applyDrive(block, driveValue);
     }
 
     // Mix dry and wet signals
     dryWetMixer.mixWetSamples(block);
+
+    // Once the tail is below -120 dBFS, flush every stage so the next block
+    // with input starts clean and the blocks in between can be skipped
+    silence.trackTail(buffer, inputActive);
+
+    if (silence.tailJustEnded())
+        resetTailState();
 }
 
-void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue)
+void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue)
 {
     // Apply drive to wet signal (Stage 4.2)
     // Convert dB to linear gain: gain = 10^(dB/20)
     float driveGain = std::pow(10.0f, driveValue / 20.0f);
 
-    // Apply gain before waveshaping (increases saturation with higher drive)
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
-    {
-        auto* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= driveGain;
-        }
-    }
+    // tanh(gain * x) (tape-like saturation), alias-suppressed by ADAA or oversampling
+    driveStage.process(block, driveGain);
 
-    // Apply tanh waveshaping (tape-like saturation)
-    driveShaper.process(context);
+    // Meter the drive output for the VU meter (after waveshaping)
+    std::array<const float*, 8> channels {};
+    const auto numChannels = juce::jmin(block.getNumChannels(), channels.size());
 
-    // Measure output level for VU meter (after waveshaping)
-    float maxLevel = 0.0f;
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
-    {
-        const float* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            maxLevel = std::max(maxLevel, std::abs(channelData[sample]));
-        }
-    }
+    for (size_t channel = 0; channel < numChannels; ++channel)
+        channels[channel] = block.getChannelPointer(channel);
 
-    // Convert to dB and store atomically
-    float levelDB = maxLevel > 0.0f
-        ? juce::Decibels::gainToDecibels(maxLevel)
-        : -60.0f;
-    driveOutputLevelDB.store(levelDB);
+    driveMeter.process(channels.data(), static_cast<int>(numChannels), static_cast<int>(block.getNumSamples()));
 }
 
 void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue)
@@ -274,6 +322,10 @@ juce::AudioProcessorEditor* DriveVerbAudioProcessor::createEditor()
 void DriveVerbAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
     auto state = parameters.copyState();
+
+    // Impulse response is referenced by path, not embedded
+    reverb.saveState(state);
+
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
 }
@@ -283,7 +335,14 @@ void DriveVerbAudioProcessor::setStateInformation(const void* data, int sizeInBy
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
-        parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+    {
+        auto state = juce::ValueTree::fromXml(*xmlState);
+        parameters.replaceState(state);
+
+        // Reload the impulse response: in the background, or before returning
+        // when rendering offline so the bounce starts with the IR in place
+        reverb.restoreState(state, isNonRealtime());
+    }
 }
 
 // Factory function
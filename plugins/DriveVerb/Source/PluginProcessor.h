@@ -1,6 +1,10 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "DriveStage.h"
+#include "HybridReverb.h"
+#include "LevelMeter.h"
+#include "SilenceTracker.h"
 
 class DriveVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -19,7 +23,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override;
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -33,8 +37,12 @@ public:
     // Public APVTS for editor access (Pattern #11)
     juce::AudioProcessorValueTreeState parameters;
 
-    // VU meter support
-    float getDriveOutputLevel() const { return driveOutputLevelDB.load(); }
+    // VU meter support (lock-free history, read at the editor's frame rate)
+    const pfs::LevelMeter& getDriveMeter() const { return driveMeter; }
+
+    // Impulse response for reverbMode = Impulse Response (loaded in the
+    // background, saved with the plugin state)
+    void loadImpulseResponse(const juce::File& file);
 
 private:
 
@@ -42,22 +50,31 @@ private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     // DSP Components (Stage 4.1: Core reverb + dry/wet mixing)
-    juce::dsp::Reverb reverb;
+    pfs::HybridReverb reverb;  // 8-line FDN (decay = RT60 in seconds) or impulse response, crossfaded
+    static constexpr float reverbDamping = 0.5f;     // HF decays at 55% of decay
+    static constexpr float reverbModulation = 0.3f;  // Subtle tap chorus against metallic ringing
     juce::dsp::DryWetMixer<float> dryWetMixer;
 
-    // Stage 4.2: Drive saturation
-    juce::dsp::WaveShaper<float> driveShaper;
+    bool isImpulseResponseSelected() const;  // Mode parameter; the FDN plays until an IR is loaded
+
+    // Tail sleep: skip all DSP once input is silent and the tail is below -120 dBFS
+    pfs::SilenceTracker silence;
+    void resetTailState();
+
+    // Stage 4.2: Drive saturation (ADAA or oversampled tanh, driveQuality).
+    // Wet path only, so its filter latency never reaches the dry signal.
+    pfs::DriveStage driveStage;
 
     // Stage 4.3: DJ-style filter (low-pass/high-pass with center bypass)
     juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
     bool previousWasLowPass = false;  // Track filter type transitions
 
     // Stage 4.4: Helper methods for PRE/POST routing
-    void applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue);
+    void applyDrive(juce::dsp::AudioBlock<float>& block, float driveValue);
     void applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue);
 
     // VU meter - drive output level
-    std::atomic<float> driveOutputLevelDB { -60.0f };
+    pfs::LevelMeter driveMeter;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DriveVerbAudioProcessor)
 };
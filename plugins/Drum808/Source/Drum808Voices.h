@@ -0,0 +1,439 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cmath>
+#include "NoiseSource.h"
+
+// Block-rendering voice kernels for Drum808.
+//
+// Every voice renders a whole (sub-)block into a mono scratch buffer. All
+// transcendental math (envelope coefficients, filter coefficients, phase
+// increments) happens once per block in setParameters(); the inner loops are
+// multiply/add only (the sine oscillator is a polynomial, see polynomialSine). Idle voices return before touching any memory.
+
+// Recursive exponential decay: value *= coefficient per sample.
+// Equivalent to exp(-t / tau) sampled at t = 0, 1/fs, 2/fs, ...
+struct DecayEnvelope
+{
+    float value = 0.0f;
+    float coefficient = 0.0f;
+
+    void setTimeConstant(float tauSeconds, double sampleRate)
+    {
+        coefficient = std::exp(-1.0f / (tauSeconds * static_cast<float>(sampleRate)));
+    }
+
+    void reset(float startValue) { value = startValue; }
+
+    inline float next()
+    {
+        const float out = value;
+        value *= coefficient;
+        return out;
+    }
+};
+
+// sin(2 pi * phase) for phase in cycles, [0, 1). Folds to a quarter cycle
+// and evaluates the odd Taylor polynomial to x^9 (max error 3.6e-6, about
+// -109dB) with no branches or libm calls.
+inline float polynomialSine(float phase)
+{
+    const float x = phase - 0.5f;                                  // [-0.5, 0.5), sin(2 pi phase) = -sin(2 pi x)
+    const float folded = std::abs(x) > 0.25f ? std::copysign(0.5f, x) - x : x;  // sin(pi - a) = sin(a)
+    const float t = juce::MathConstants<float>::twoPi * folded;     // [-pi/2, pi/2]
+    const float t2 = t * t;
+    const float s = t * (1.0f + t2 * (-1.0f / 6.0f + t2 * (1.0f / 120.0f + t2 * (-1.0f / 5040.0f + t2 * (1.0f / 362880.0f)))));
+    return -s;
+}
+
+// TPT state variable bandpass (same topology and output as
+// juce::dsp::StateVariableTPTFilter in bandpass mode), mono, with
+// coefficients that are only recomputed when setParameters() is called.
+struct BandpassSVF
+{
+    float g = 0.0f;
+    float R2 = 2.0f;
+    float h = 0.0f;
+    float s1 = 0.0f;
+    float s2 = 0.0f;
+
+    void setParameters(float cutoffHz, float resonance, double sampleRate)
+    {
+        const float nyquistSafe = static_cast<float>(sampleRate) * 0.49f;
+        const float cutoff = juce::jlimit(10.0f, nyquistSafe, cutoffHz);
+
+        g = std::tan(juce::MathConstants<float>::pi * cutoff / static_cast<float>(sampleRate));
+        R2 = 1.0f / resonance;
+        h = 1.0f / (1.0f + R2 * g + g * g);
+    }
+
+    void reset() { s1 = s2 = 0.0f; }
+
+    inline float process(float x)
+    {
+        const float yHP = h * (x - s1 * (g + R2) - s2);
+        const float yBP = yHP * g + s1;
+        s1 = yHP * g + yBP;
+        const float yLP = yBP * g + s2;
+        s2 = yBP * g + yLP;
+        return yBP;
+    }
+};
+
+// Sine voice specialised at compile time:
+//   Kick = pitch sweep + noise click, no filter
+//   Tom  = fixed pitch latched at trigger + bandpass
+template <bool HasPitchSweep, bool HasClick, bool HasBandpass>
+struct ToneVoice
+{
+    bool isPlaying = false;
+    float velocity = 0.0f;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        if constexpr (HasPitchSweep)
+            pitchEnvelope.setTimeConstant(0.02f, sampleRate);   // 2× → 1× sweep
+
+        if constexpr (HasClick)
+            clickEnvelope.setTimeConstant(0.005f, sampleRate);  // 5ms noise burst
+
+        filter.reset();
+        stop();
+    }
+
+    // Deterministic per-voice noise stream (click burst)
+    void seedNoise(uint64_t seed)
+    {
+        noise.setSeed(seed);
+    }
+
+    // Called once per block with the current parameter values.
+    // tone = click amount (kick) or filter Q amount (tom).
+    void setParameters(float baseFrequency, float decaySeconds, float level, float tone)
+    {
+        baseIncrement = baseFrequency / static_cast<float>(sampleRate);
+        amplitudeEnvelope.setTimeConstant(decaySeconds, sampleRate);
+        outputLevel = level;
+
+        if constexpr (HasClick)
+            clickLevel = tone;
+
+        if constexpr (HasBandpass)
+            filter.setParameters(baseFrequency, 0.5f + tone * 4.5f, sampleRate);
+    }
+
+    void trigger(float velocityGain)
+    {
+        isPlaying = true;
+        velocity = velocityGain;
+        phase = 0.0f;
+        phaseIncrement = baseIncrement;
+        amplitudeEnvelope.reset(1.0f);
+
+        if constexpr (HasPitchSweep)
+            pitchEnvelope.reset(1.0f);
+
+        if constexpr (HasClick)
+            clickEnvelope.reset(1.0f);
+    }
+
+    void stop()
+    {
+        isPlaying = false;
+    }
+
+    // Overwrites dest[0, numSamples) while playing; untouched when idle.
+    void render(float* dest, int numSamples)
+    {
+        if (! isPlaying)
+            return;
+
+        const float gain = velocity * outputLevel;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float increment = phaseIncrement;
+
+            if constexpr (HasPitchSweep)
+                increment = baseIncrement * (1.0f + pitchEnvelope.next());
+
+            float signal = polynomialSine(phase);
+            phase += increment;
+            phase -= std::floor(phase);
+
+            if constexpr (HasClick)
+                signal += noise.nextBipolar() * clickEnvelope.next() * clickLevel;
+
+            if constexpr (HasBandpass)
+                signal = filter.process(signal);
+
+            dest[i] = signal * amplitudeEnvelope.next() * gain;
+        }
+
+        // Denormal protection: retire the voice once the envelope is inaudible
+        if (amplitudeEnvelope.value < 1e-8f)
+            stop();
+    }
+
+private:
+    double sampleRate = 44100.0;
+
+    float phase = 0.0f;           // cycles, [0, 1)
+    float phaseIncrement = 0.0f;  // latched at trigger (fixed-pitch voices)
+    float baseIncrement = 0.0f;   // current parameter value
+    float outputLevel = 0.0f;
+    float clickLevel = 0.0f;
+
+    DecayEnvelope amplitudeEnvelope;
+    DecayEnvelope pitchEnvelope;
+    DecayEnvelope clickEnvelope;
+    BandpassSVF filter;
+    pfs::NoiseSource noise;
+};
+
+using KickVoice = ToneVoice<true, true, false>;
+using TomVoice = ToneVoice<false, false, true>;
+
+// Band-limited square oscillator bank for the hi-hats.
+//
+// The six inharmonic partials run as lanes of one fixed-width vector
+// (padded to 8 so it maps onto 1×AVX or 2×SSE/NEON registers). Every lane
+// is a PolyBLEP square; the lane loop is branch-free so the compiler emits
+// compares + blends rather than jumps. Frequencies are updated once per block.
+struct HiHatOscillatorBank
+{
+    static constexpr int numPartials = 6;
+    static constexpr int numLanes = 8;
+
+    void setFrequencies(float baseFrequency, double sampleRate)
+    {
+        static constexpr float ratios[numPartials] = { 1.0f, 1.4f, 1.7f, 2.1f, 2.5f, 3.0f };
+
+        for (int k = 0; k < numLanes; ++k)
+        {
+            // Padding lanes run a harmless dummy partial with zero weight
+            const float ratio = k < numPartials ? ratios[k] : 1.0f;
+            const float dt = juce::jlimit(1.0e-6f, 0.45f, baseFrequency * ratio / static_cast<float>(sampleRate));
+
+            increment[k] = dt;
+            inverseIncrement[k] = 1.0f / dt;
+            weight[k] = k < numPartials ? 1.0f / numPartials : 0.0f;
+        }
+    }
+
+    inline float processSample()
+    {
+        alignas(32) float lane[numLanes];
+
+        for (int k = 0; k < numLanes; ++k)
+        {
+            const float t = phase[k];
+            const float dt = increment[k];
+            const float invDt = inverseIncrement[k];
+
+            const float halfShifted = t < 0.5f ? t + 0.5f : t - 0.5f;
+            float square = t < 0.5f ? 1.0f : -1.0f;
+            square += polyBlep(t, dt, invDt);            // rising edge at t = 0
+            square -= polyBlep(halfShifted, dt, invDt);  // falling edge at t = 0.5
+
+            lane[k] = square * weight[k];
+
+            const float next = t + dt;
+            phase[k] = next >= 1.0f ? next - 1.0f : next;
+        }
+
+        float sum = 0.0f;
+
+        for (int k = 0; k < numLanes; ++k)
+            sum += lane[k];
+
+        return sum;
+    }
+
+private:
+    // Two-sample polynomial residual of a unit step at t = 0 (branch-free)
+    static inline float polyBlep(float t, float dt, float invDt)
+    {
+        const float a = t * invDt;           // just after the edge
+        const float b = (t - 1.0f) * invDt;  // just before the edge
+        const float after = t < dt ? a + a - a * a - 1.0f : 0.0f;
+        const float before = t > 1.0f - dt ? b * b + b + b + 1.0f : 0.0f;
+        return after + before;
+    }
+
+    alignas(32) float phase[numLanes] = {};
+    alignas(32) float increment[numLanes] = {};
+    alignas(32) float inverseIncrement[numLanes] = {};
+    alignas(32) float weight[numLanes] = {};
+};
+
+// Hi-hat voice (shared by Closed and Open): band-limited 6-partial square
+// bank into a high-Q bandpass. Oscillators free-run between hits like the
+// original circuit.
+struct HiHatVoice
+{
+    bool isPlaying = false;
+    float velocity = 0.0f;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        filter.reset();
+        stop();
+    }
+
+    void setParameters(float baseFrequency, float centreFrequency, float decaySeconds, float level)
+    {
+        oscillators.setFrequencies(baseFrequency, sampleRate);
+        filter.setParameters(centreFrequency, 4.0f, sampleRate);  // High Q for metallic ring
+        amplitudeEnvelope.setTimeConstant(decaySeconds, sampleRate);
+        outputLevel = level;
+    }
+
+    void trigger(float velocityGain)
+    {
+        isPlaying = true;
+        velocity = velocityGain;
+        amplitudeEnvelope.reset(1.0f);
+    }
+
+    void stop()
+    {
+        isPlaying = false;
+    }
+
+    void render(float* dest, int numSamples)
+    {
+        if (! isPlaying)
+            return;
+
+        const float gain = velocity * outputLevel;
+
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = filter.process(oscillators.processSample()) * amplitudeEnvelope.next() * gain;
+
+        if (amplitudeEnvelope.value < 1e-8f)
+            stop();
+    }
+
+private:
+    double sampleRate = 44100.0;
+    float outputLevel = 0.0f;
+
+    HiHatOscillatorBank oscillators;
+    DecayEnvelope amplitudeEnvelope;
+    BandpassSVF filter;
+};
+
+// Clap voice: bandpassed noise through a multi-trigger envelope
+// (3 spikes 10ms apart, then a long decay tail). Each envelope stage is
+// rendered as its own branch-free run.
+struct ClapVoice
+{
+    enum class Stage { Spike1, Spike2, Spike3, Decay };
+
+    bool isPlaying = false;
+    float velocity = 0.0f;
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        // Sample-rate independent stage boundaries
+        stageEndSample[0] = static_cast<int>(sampleRate * 0.010);  // 10ms
+        stageEndSample[1] = static_cast<int>(sampleRate * 0.020);  // 20ms
+        stageEndSample[2] = static_cast<int>(sampleRate * 0.030);  // 30ms
+
+        spikeEnvelope.setTimeConstant(0.003f, sampleRate);
+        tailEnvelope.setTimeConstant(1.934f, sampleRate);
+        filter.reset();
+        stop();
+    }
+
+    void seedNoise(uint64_t seed)
+    {
+        noise.setSeed(seed);
+    }
+
+    void setParameters(float centreFrequency, float resonance, float snap, float level)
+    {
+        filter.setParameters(centreFrequency, resonance, sampleRate);
+        snapAmount = snap;
+        outputLevel = level;
+    }
+
+    void trigger(float velocityGain)
+    {
+        isPlaying = true;
+        velocity = velocityGain;
+        stage = Stage::Spike1;
+        envelopeSample = 0;
+        spikeEnvelope.reset(1.0f);
+    }
+
+    void stop()
+    {
+        isPlaying = false;
+    }
+
+    void render(float* dest, int numSamples)
+    {
+        if (! isPlaying)
+            return;
+
+        static constexpr float spikeLevels[3] = { 1.0f, 0.6f, 0.3f };
+        const float gain = velocity * outputLevel;
+        int done = 0;
+
+        while (done < numSamples)
+        {
+            const bool inTail = stage == Stage::Decay;
+            const int stageIndex = static_cast<int>(stage);
+            const int remaining = numSamples - done;
+            const int runLength = inTail ? remaining
+                                         : juce::jmin(remaining, stageEndSample[stageIndex] - envelopeSample);
+
+            auto& envelope = inTail ? tailEnvelope : spikeEnvelope;
+            const float runGain = inTail ? gain : gain * snapAmount * spikeLevels[stageIndex];
+            float* out = dest + done;
+
+            // White noise for the whole run in one vectorised fill, filtered in place
+            noise.fillBipolar(out, runLength);
+
+            for (int i = 0; i < runLength; ++i)
+                out[i] = filter.process(out[i]) * envelope.next() * runGain;
+
+            done += runLength;
+            envelopeSample += runLength;
+
+            if (! inTail && envelopeSample >= stageEndSample[stageIndex])
+            {
+                stage = static_cast<Stage>(stageIndex + 1);
+
+                if (stage == Stage::Decay)
+                    tailEnvelope.reset(1.0f);
+                else
+                    spikeEnvelope.reset(1.0f);
+            }
+        }
+
+        // Stop voice after decay tail (envelope < threshold)
+        if (stage == Stage::Decay && tailEnvelope.value < 1e-4f)
+            stop();
+    }
+
+private:
+    double sampleRate = 44100.0;
+
+    Stage stage = Stage::Spike1;
+    int envelopeSample = 0;
+    int stageEndSample[3] = {};
+    float snapAmount = 0.0f;
+    float outputLevel = 0.0f;
+
+    DecayEnvelope spikeEnvelope;
+    DecayEnvelope tailEnvelope;
+    BandpassSVF filter;
+    pfs::NoiseSource noise;
+};
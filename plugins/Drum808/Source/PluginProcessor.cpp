@@ -204,6 +204,23 @@ juce::AudioProcessorValueTreeState::ParameterLayout Drum808AudioProcessor::creat
         "st"
     ));
 
+    // PAN (one per voice, -100% left to +100% right; main mix and stereo individual outputs)
+    static constexpr const char* panVoices[][2] = {
+        { "kick", "Kick" }, { "lowtom", "Low Tom" }, { "midtom", "Mid Tom" },
+        { "clap", "Clap" }, { "closedhat", "Closed Hat" }, { "openhat", "Open Hat" }
+    };
+
+    for (const auto& voice : panVoices)
+    {
+        layout.add(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID { juce::String(voice[0]) + "_pan", 1 },
+            juce::String(voice[1]) + " Pan",
+            juce::NormalisableRange<float>(-100.0f, 100.0f, 0.1f),
+            0.0f,
+            "%"
+        ));
+    }
+
     return layout;
 }
 
@@ -228,76 +245,24 @@ void Drum808AudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 {
     currentSampleRate = sampleRate;
 
-    // Prepare DSP spec
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
-
-    // Configure and prepare Low Tom
-    lowTom.oscillator.initialise([](float x) { return std::sin(x); }); // Sine wave
-    lowTom.oscillator.prepare(spec);
-    lowTom.filter.prepare(spec);
-    lowTom.filter.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    lowTom.filter.setResonance(0.5f); // Initial Q (will be updated per-sample)
-    lowTom.oscillator.reset();
-    lowTom.filter.reset();
-
-    // Configure and prepare Mid Tom
-    midTom.oscillator.initialise([](float x) { return std::sin(x); }); // Sine wave
-    midTom.oscillator.prepare(spec);
-    midTom.filter.prepare(spec);
-    midTom.filter.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    midTom.filter.setResonance(0.5f); // Initial Q (will be updated per-sample)
-    midTom.oscillator.reset();
-    midTom.filter.reset();
-
-    // Configure and prepare Kick
-    kick.bodyOscillator.initialise([](float x) { return std::sin(x); }); // Sine wave for body tone
-    kick.bodyOscillator.prepare(spec);
-    kick.bodyOscillator.reset();
-
-    // Configure and prepare Closed Hi-Hat (6 square wave oscillators)
-    for (int i = 0; i < 6; ++i)
-    {
-        closedHat.oscillators[i].initialise([](float x) {
-            return x < 0.0f ? -1.0f : 1.0f; // Square wave
-        });
-        closedHat.oscillators[i].prepare(spec);
-        closedHat.oscillators[i].reset();
-    }
-    closedHat.filter.prepare(spec);
-    closedHat.filter.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    closedHat.filter.setResonance(4.0f); // High Q for metallic ring
-    closedHat.filter.reset();
+    // Voice kernels (envelope/filter state reset, stage timing in samples)
+    kick.prepare(sampleRate);
+    lowTom.prepare(sampleRate);
+    midTom.prepare(sampleRate);
+    clap.prepare(sampleRate);
+    closedHat.prepare(sampleRate);
+    openHat.prepare(sampleRate);
 
-    // Configure and prepare Open Hi-Hat (6 square wave oscillators)
-    for (int i = 0; i < 6; ++i)
-    {
-        openHat.oscillators[i].initialise([](float x) {
-            return x < 0.0f ? -1.0f : 1.0f; // Square wave
-        });
-        openHat.oscillators[i].prepare(spec);
-        openHat.oscillators[i].reset();
-    }
-    openHat.filter.prepare(spec);
-    openHat.filter.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    openHat.filter.setResonance(4.0f); // High Q for metallic ring
-    openHat.filter.reset();
-
-    // Configure and prepare Clap (filtered noise with multi-trigger envelope)
-    juce::dsp::ProcessSpec monoSpec;
-    monoSpec.sampleRate = sampleRate;
-    monoSpec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    monoSpec.numChannels = 1; // Mono voice
-
-    clap.bandpassFilter.prepare(monoSpec);
-    clap.bandpassFilter.setType(juce::dsp::StateVariableTPTFilterType::bandpass);
-    clap.bandpassFilter.reset();
-
-    // Calculate spike transition samples (sample-rate independent)
-    clap.spike2StartSample = static_cast<int>(sampleRate * 0.010);  // 10ms
-    clap.spike3StartSample = static_cast<int>(sampleRate * 0.020);  // 20ms
-    clap.decayStartSample = static_cast<int>(sampleRate * 0.030);   // 30ms
+    // Re-seed the noise voices so every render from a transport start is identical
+    kick.seedNoise(pfs::NoiseSource::streamSeed(noiseSeed, kickVoice));
+    clap.seedNoise(pfs::NoiseSource::streamSeed(noiseSeed, clapVoice));
+
+    // Per-voice mono scratch
+    voiceBuffer.setSize(numVoices, samplesPerBlock);
+    voiceBuffer.clear();
+    voiceRendered.fill(false);
+
+    silence.prepare(sampleRate, 0.05);
 }
 
 void Drum808AudioProcessor::releaseResources()
@@ -305,13 +270,54 @@ void Drum808AudioProcessor::releaseResources()
     // Cleanup will be added in Stage 3
 }
 
+void Drum808AudioProcessor::renderVoices(int startSample, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    // Idle voices cost one branch per sub-block. A voice that was silent so
+    // far this block zero-fills its scratch prefix the first time it sounds;
+    // one that stopped earlier in the block zero-fills the rest.
+    auto renderVoice = [this, startSample, numSamples](auto& voice, int index)
+    {
+        float* dest = voiceBuffer.getWritePointer(index);
+
+        if (voice.isPlaying)
+        {
+            if (! voiceRendered[(size_t) index])
+            {
+                juce::FloatVectorOperations::clear(dest, startSample);
+                voiceRendered[(size_t) index] = true;
+            }
+
+            voice.render(dest + startSample, numSamples);
+        }
+        else if (voiceRendered[(size_t) index])
+        {
+            juce::FloatVectorOperations::clear(dest + startSample, numSamples);
+        }
+    };
+
+    renderVoice(kick, kickVoice);
+    renderVoice(lowTom, lowTomVoice);
+    renderVoice(midTom, midTomVoice);
+    renderVoice(clap, clapVoice);
+    renderVoice(closedHat, closedHatVoice);
+    renderVoice(openHat, openHatVoice);
+}
+
 void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
 
-    // Clear all output buses
-    buffer.clear();
+    // Idle instance: no voice sounding and nothing to trigger
+    if (silence.isIdle(anyVoicePlaying(), midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        return;
+    }
 
+    // Every enabled bus is fully overwritten below, so no up-front clear
     const int numSamples = buffer.getNumSamples();
 
     // Read all voice parameters (atomic, real-time safe)
@@ -388,315 +394,189 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const float openHatBaseFreq = 3500.0f * std::pow(2.0f, openHatTuning / 12.0f);
 
     // Map tone parameters
-    const float lowTomQ = 0.5f + (lowTomTone * 4.5f);
-    const float midTomQ = 0.5f + (midTomTone * 4.5f);
     const float clapQ = 2.0f + (clapTone * 3.0f); // Q range 2.0-5.0
     const float closedHatCenterFreq = 6000.0f + (closedHatTone * 6000.0f); // 6-12 kHz
     const float openHatCenterFreq = 6000.0f + (openHatTone * 6000.0f);
 
-    // Process MIDI messages
-    for (const auto metadata : midiMessages)
-    {
-        auto message = metadata.getMessage();
-
-        if (message.isNoteOn())
-        {
-            int note = message.getNoteNumber();
-            float velocity = message.getVelocity() / 127.0f;
+    // Pan gains per voice, constant power normalised to unity at centre:
+    // L = sqrt(2) cos(theta), R = sqrt(2) sin(theta), theta = (pan + 1) * pi / 4,
+    // so a centred voice lands on both channels unchanged and L^2 + R^2 is
+    // the same at every position
+    static constexpr const char* panIds[numVoices] = {
+        "kick_pan", "lowtom_pan", "midtom_pan", "clap_pan", "closedhat_pan", "openhat_pan"
+    };
 
-            // Map MIDI notes to voices
-            if (note == 36) // C1 → Kick
-            {
-                kick.trigger(velocity);
-                kickTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 38) // D1 → Clap
-            {
-                clap.trigger(velocity);
-                clapTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 41) // F1 → Low Tom
-            {
-                lowTom.trigger(velocity, lowTomBaseFreq);
-                lowTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
-            {
-                // FIRST: Choke open hat (stop immediately)
-                openHat.stop();
-
-                // THEN: Trigger closed hat
-                closedHat.trigger(velocity);
-                closedHatTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 45) // A1 → Mid Tom
-            {
-                midTom.trigger(velocity, midTomBaseFreq);
-                midTomTriggered.store(true, std::memory_order_relaxed);
-            }
-            else if (note == 46) // A#1 → Open Hat
-            {
-                openHat.trigger(velocity);
-                openHatTriggered.store(true, std::memory_order_relaxed);
-            }
-        }
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        const float pan = parameters.getRawParameterValue(panIds[voice])->load() / 100.0f;
+        const float theta = (pan + 1.0f) * juce::MathConstants<float>::pi * 0.25f;
+        panGains[(size_t) voice] = { juce::MathConstants<float>::sqrt2 * std::cos(theta),
+                                     juce::MathConstants<float>::sqrt2 * std::sin(theta) };
     }
 
-    // Configure clap filter (outside loop for efficiency)
-    clap.bandpassFilter.setCutoffFrequency(clapCenterFreq);
-    clap.bandpassFilter.setResonance(clapQ);
+    // Per-block coefficient updates (the only transcendental math in the block)
+    kick.setParameters(kickBaseFreq, kickDecay, kickLevel, kickTone);
+    lowTom.setParameters(lowTomBaseFreq, lowTomDecay, lowTomLevel, lowTomTone);
+    midTom.setParameters(midTomBaseFreq, midTomDecay, midTomLevel, midTomTone);
+    clap.setParameters(clapCenterFreq, clapQ, clapSnap, clapLevel);
+    closedHat.setParameters(closedHatBaseFreq, closedHatCenterFreq, closedHatDecay, closedHatLevel);
+    openHat.setParameters(openHatBaseFreq, openHatCenterFreq, openHatDecay, openHatLevel);
 
-    // Synthesize voices (per-sample processing)
-    for (int sample = 0; sample < numSamples; ++sample)
-    {
-        float kickSample = 0.0f;
-        float lowTomSample = 0.0f;
-        float midTomSample = 0.0f;
-        float clapSample = 0.0f;
-        float closedHatSample = 0.0f;
-        float openHatSample = 0.0f;
-
-        // Kick synthesis (pitch envelope + attack transient)
-        if (kick.isPlaying)
-        {
-            // Pitch envelope: exponential sweep from 2× to 1× base frequency
-            float currentFreq = kickBaseFreq * (1.0f + std::exp(-kick.envelopeTime / 0.02f));
-            kick.bodyOscillator.setFrequency(currentFreq);
+    // Hosts may exceed the announced block size; no-op otherwise
+    voiceBuffer.setSize(numVoices, numSamples, false, false, true);
+    voiceRendered.fill(false);
 
-            // Body tone (sine oscillator)
-            float bodySignal = kick.bodyOscillator.processSample(0.0f);
+    // Render voices in sub-blocks between MIDI events (sample-accurate triggers)
+    int renderPosition = 0;
 
-            // Attack transient (noise burst scaled by tone parameter)
-            float attackSignal = (kick.noiseGenerator.nextFloat() * 2.0f - 1.0f) *
-                                 std::exp(-kick.envelopeTime / 0.005f) * kickTone;
+    for (const auto metadata : midiMessages)
+    {
+        auto message = metadata.getMessage();
 
-            // Amplitude envelope (exponential decay)
-            float amplitudeEnv = std::exp(-kick.envelopeTime / kickDecay);
+        if (! message.isNoteOn())
+            continue;
 
-            // Denormal protection
-            if (amplitudeEnv < 1e-8f)
-            {
-                kick.stop();
-                amplitudeEnv = 0.0f;
-            }
+        const int eventPosition = juce::jlimit(renderPosition, numSamples, metadata.samplePosition);
+        renderVoices(renderPosition, eventPosition - renderPosition);
+        renderPosition = eventPosition;
 
-            // Final output
-            kickSample = (bodySignal + attackSignal) * amplitudeEnv * kick.velocity * kickLevel;
+        int note = message.getNoteNumber();
+        float velocity = message.getVelocity() / 127.0f;
 
-            // Advance envelope time
-            kick.envelopeTime += 1.0f / static_cast<float>(currentSampleRate);
+        // Map MIDI notes to voices
+        if (note == 36) // C1 → Kick
+        {
+            kick.trigger(velocity);
+            kickTriggered.store(true, std::memory_order_relaxed);
         }
-
-        // Low Tom synthesis
-        if (lowTom.isPlaying)
+        else if (note == 38) // D1 → Clap
         {
-            lowTom.filter.setCutoffFrequency(lowTomBaseFreq);
-            lowTom.filter.setResonance(lowTomQ);
-
-            float oscSample = lowTom.oscillator.processSample(0.0f);
-            float filteredSample = lowTom.filter.processSample(0, oscSample);
-            float envelope = std::exp(-lowTom.envelopeTime / lowTomDecay);
-
-            if (envelope < 1e-8f)
-            {
-                lowTom.stop();
-                envelope = 0.0f;
-            }
-
-            lowTomSample = filteredSample * envelope * lowTom.velocity * lowTomLevel;
-            lowTom.envelopeTime += 1.0f / static_cast<float>(currentSampleRate);
+            clap.trigger(velocity);
+            clapTriggered.store(true, std::memory_order_relaxed);
         }
-
-        // Mid Tom synthesis
-        if (midTom.isPlaying)
+        else if (note == 41) // F1 → Low Tom
         {
-            midTom.filter.setCutoffFrequency(midTomBaseFreq);
-            midTom.filter.setResonance(midTomQ);
-
-            float oscSample = midTom.oscillator.processSample(0.0f);
-            float filteredSample = midTom.filter.processSample(0, oscSample);
-            float envelope = std::exp(-midTom.envelopeTime / midTomDecay);
-
-            if (envelope < 1e-8f)
-            {
-                midTom.stop();
-                envelope = 0.0f;
-            }
-
-            midTomSample = filteredSample * envelope * midTom.velocity * midTomLevel;
-            midTom.envelopeTime += 1.0f / static_cast<float>(currentSampleRate);
+            lowTom.trigger(velocity);
+            lowTomTriggered.store(true, std::memory_order_relaxed);
         }
-
-        // Clap synthesis (multi-trigger envelope + filtered noise)
-        if (clap.isPlaying)
+        else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
         {
-            // Generate white noise
-            float noise = juce::Random::getSystemRandom().nextFloat() * 2.0f - 1.0f;
+            // FIRST: Choke open hat (stop immediately)
+            openHat.stop();
 
-            // Apply bandpass filter
-            float filteredNoise = clap.bandpassFilter.processSample(0, noise);
+            // THEN: Trigger closed hat
+            closedHat.trigger(velocity);
+            closedHatTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 45) // A1 → Mid Tom
+        {
+            midTom.trigger(velocity);
+            midTomTriggered.store(true, std::memory_order_relaxed);
+        }
+        else if (note == 46) // A#1 → Open Hat
+        {
+            openHat.trigger(velocity);
+            openHatTriggered.store(true, std::memory_order_relaxed);
+        }
+    }
 
-            // Calculate envelope based on state machine
-            float envelope = 0.0f;
-            int t = clap.envelopeSample;
+    renderVoices(renderPosition, numSamples - renderPosition);
 
-            if (clap.envelopeState == ClapEnvelopeState::Spike1)
-            {
-                float timeInSpike = t / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * std::exp(-timeInSpike / 0.003f);
+    writeOutputBuses(buffer);
 
-                if (t >= clap.spike2StartSample)
-                {
-                    clap.envelopeState = ClapEnvelopeState::Spike2;
-                }
-            }
-            else if (clap.envelopeState == ClapEnvelopeState::Spike2)
-            {
-                float timeInSpike = (t - clap.spike2StartSample) / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * 0.6f * std::exp(-timeInSpike / 0.003f);
-
-                if (t >= clap.spike3StartSample)
-                {
-                    clap.envelopeState = ClapEnvelopeState::Spike3;
-                }
-            }
-            else if (clap.envelopeState == ClapEnvelopeState::Spike3)
-            {
-                float timeInSpike = (t - clap.spike3StartSample) / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * 0.3f * std::exp(-timeInSpike / 0.003f);
+    silence.trackTail(buffer, anyVoicePlaying());
+}
 
-                if (t >= clap.decayStartSample)
-                {
-                    clap.envelopeState = ClapEnvelopeState::Decay;
-                }
-            }
-            else if (clap.envelopeState == ClapEnvelopeState::Decay)
-            {
-                float timeInDecay = (t - clap.decayStartSample) / static_cast<float>(currentSampleRate);
-                envelope = std::exp(-timeInDecay / 1.934f);
-
-                // Stop voice after decay tail (envelope < threshold)
-                if (envelope < 1e-4f)
-                {
-                    clap.stop();
-                    envelope = 0.0f;
-                }
-            }
+bool Drum808AudioProcessor::anyVoicePlaying() const
+{
+    return kick.isPlaying || lowTom.isPlaying || midTom.isPlaying
+        || clap.isPlaying || closedHat.isPlaying || openHat.isPlaying;
+}
 
-            // Apply envelope, level, and velocity
-            clapSample = filteredNoise * envelope * clapLevel * clap.velocity;
+bool Drum808AudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // Main mix: mono or stereo, always enabled
+    const auto mainLayout = layouts.getMainOutputChannelSet();
 
-            clap.envelopeSample++;
-        }
+    if (mainLayout != juce::AudioChannelSet::mono() && mainLayout != juce::AudioChannelSet::stereo())
+        return false;
 
-        // Closed Hi-Hat synthesis (6 oscillators + bandpass)
-        if (closedHat.isPlaying)
-        {
-            // Frequency ratios for inharmonic spectrum
-            const float ratios[6] = {1.0f, 1.4f, 1.7f, 2.1f, 2.5f, 3.0f};
-            float mixedSignal = 0.0f;
+    // Individual outputs: disabled, mono or stereo
+    for (int bus = 1; bus < layouts.outputBuses.size(); ++bus)
+    {
+        const auto busLayout = layouts.getChannelSet(false, bus);
 
-            // Mix 6 square wave oscillators
-            for (int i = 0; i < 6; ++i)
-            {
-                closedHat.oscillators[i].setFrequency(closedHatBaseFreq * ratios[i]);
-                mixedSignal += closedHat.oscillators[i].processSample(0.0f) / 6.0f;
-            }
+        if (! busLayout.isDisabled()
+            && busLayout != juce::AudioChannelSet::mono()
+            && busLayout != juce::AudioChannelSet::stereo())
+            return false;
+    }
 
-            // Bandpass filtering (6-12 kHz controlled by tone)
-            closedHat.filter.setCutoffFrequency(closedHatCenterFreq);
-            float filteredSignal = closedHat.filter.processSample(0, mixedSignal);
+    return true;
+}
 
-            // Exponential decay
-            float envelope = std::exp(-closedHat.envelopeTime / closedHatDecay);
+void Drum808AudioProcessor::writeOutputBuses(juce::AudioBuffer<float>& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
 
-            if (envelope < 1e-8f)
-            {
-                closedHat.stop();
-                envelope = 0.0f;
-            }
+    // Main mix (bus 0): stereo is the panned vector sum of the active voices;
+    // mono is the plain sum (no pan)
+    auto mainBus = getBusBuffer(buffer, false, 0);
+    const int mainChannels = juce::jmin(mainBus.getNumChannels(), 2);
 
-            closedHatSample = filteredSignal * envelope * closedHat.velocity * closedHatLevel;
-            closedHat.envelopeTime += 1.0f / static_cast<float>(currentSampleRate);
-        }
+    if (mainChannels > 0)
+    {
+        bool mixHasSignal = false;
 
-        // Open Hi-Hat synthesis (6 oscillators + bandpass, longer decay)
-        if (openHat.isPlaying)
+        for (int voice = 0; voice < numVoices; ++voice)
         {
-            const float ratios[6] = {1.0f, 1.4f, 1.7f, 2.1f, 2.5f, 3.0f};
-            float mixedSignal = 0.0f;
+            if (! voiceRendered[(size_t) voice])
+                continue;
 
-            for (int i = 0; i < 6; ++i)
-            {
-                openHat.oscillators[i].setFrequency(openHatBaseFreq * ratios[i]);
-                mixedSignal += openHat.oscillators[i].processSample(0.0f) / 6.0f;
-            }
+            const float* source = voiceBuffer.getReadPointer(voice);
 
-            openHat.filter.setCutoffFrequency(openHatCenterFreq);
-            float filteredSignal = openHat.filter.processSample(0, mixedSignal);
-
-            float envelope = std::exp(-openHat.envelopeTime / openHatDecay);
-
-            if (envelope < 1e-8f)
+            for (int channel = 0; channel < mainChannels; ++channel)
             {
-                openHat.stop();
-                envelope = 0.0f;
-            }
+                float* mix = mainBus.getWritePointer(channel);
+                const float gain = mainChannels == 1 ? 1.0f : panGains[(size_t) voice][(size_t) channel];
 
-            openHatSample = filteredSignal * envelope * openHat.velocity * openHatLevel;
-            openHat.envelopeTime += 1.0f / static_cast<float>(currentSampleRate);
-        }
-
-        // Write to output buses
-        // Main mix (bus 0, stereo)
-        if (buffer.getNumChannels() >= 2)
-        {
-            float mainMix = kickSample + lowTomSample + midTomSample + clapSample + closedHatSample + openHatSample;
-            buffer.addSample(0, sample, mainMix); // Left
-            buffer.addSample(1, sample, mainMix); // Right
-        }
+                if (mixHasSignal)
+                    juce::FloatVectorOperations::addWithMultiply(mix, source, gain, numSamples);
+                else
+                    juce::FloatVectorOperations::copyWithMultiply(mix, source, gain, numSamples);
+            }
 
-        // Individual outputs (if enabled by DAW)
-        // Kick output (bus 1, channels 2-3)
-        if (buffer.getNumChannels() >= 4)
-        {
-            buffer.addSample(2, sample, kickSample); // Kick Left
-            buffer.addSample(3, sample, kickSample); // Kick Right
+            mixHasSignal = true;
         }
 
-        // Low Tom output (bus 2, channels 4-5)
-        if (buffer.getNumChannels() >= 6)
+        for (int channel = 0; channel < mainBus.getNumChannels(); ++channel)
         {
-            buffer.addSample(4, sample, lowTomSample); // Low Tom Left
-            buffer.addSample(5, sample, lowTomSample); // Low Tom Right
+            if (! mixHasSignal || channel >= mainChannels)
+                juce::FloatVectorOperations::clear(mainBus.getWritePointer(channel), numSamples);
         }
+    }
 
-        // Mid Tom output (bus 3, channels 6-7)
-        if (buffer.getNumChannels() >= 8)
-        {
-            buffer.addSample(6, sample, midTomSample); // Mid Tom Left
-            buffer.addSample(7, sample, midTomSample); // Mid Tom Right
-        }
+    // Individual outputs (bus voice + 1): buses the host disabled have no
+    // channels in the buffer and are skipped outright. Stereo buses carry
+    // the voice's pan, mono buses the voice as rendered.
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        const int busIndex = voice + 1;
+        auto* bus = getBus(false, busIndex);
 
-        // Clap output (bus 4, channels 8-9)
-        if (buffer.getNumChannels() >= 10)
-        {
-            buffer.addSample(8, sample, clapSample); // Clap Left
-            buffer.addSample(9, sample, clapSample); // Clap Right
-        }
+        if (bus == nullptr || ! bus->isEnabled())
+            continue;
 
-        // Closed Hat output (bus 5, channels 10-11)
-        if (buffer.getNumChannels() >= 12)
-        {
-            buffer.addSample(10, sample, closedHatSample); // Closed Hat Left
-            buffer.addSample(11, sample, closedHatSample); // Closed Hat Right
-        }
+        auto voiceBus = getBusBuffer(buffer, false, busIndex);
+        const bool panned = voiceBus.getNumChannels() == 2;
 
-        // Open Hat output (bus 6, channels 12-13)
-        if (buffer.getNumChannels() >= 14)
+        for (int channel = 0; channel < voiceBus.getNumChannels(); ++channel)
         {
-            buffer.addSample(12, sample, openHatSample); // Open Hat Left
-            buffer.addSample(13, sample, openHatSample); // Open Hat Right
+            if (voiceRendered[(size_t) voice])
+                juce::FloatVectorOperations::copyWithMultiply(voiceBus.getWritePointer(channel), voiceBuffer.getReadPointer(voice),
+                                                              panned ? panGains[(size_t) voice][(size_t) channel] : 1.0f, numSamples);
+            else
+                juce::FloatVectorOperations::clear(voiceBus.getWritePointer(channel), numSamples);
         }
     }
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "Drum808Voices.h"
+#include "SilenceTracker.h"
 
 class Drum808AudioProcessor : public juce::AudioProcessor
 {
@@ -11,6 +13,7 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -43,115 +46,18 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Tom Voice structure (used for both Low Tom and Mid Tom)
-    struct TomVoice
-    {
-        juce::dsp::Oscillator<float> oscillator;
-        juce::dsp::StateVariableTPTFilter<float> filter;
-
-        bool isPlaying = false;
-        float envelopeTime = 0.0f;
-        float velocity = 0.0f;
-
-        void trigger(float velocityGain, float baseFreq)
-        {
-            isPlaying = true;
-            envelopeTime = 0.0f;
-            velocity = velocityGain;
-            oscillator.setFrequency(baseFreq);
-            filter.setCutoffFrequency(baseFreq);
-        }
-
-        void stop()
-        {
-            isPlaying = false;
-            envelopeTime = 0.0f;
-        }
-    };
-
-    // Kick Voice structure
-    struct KickVoice
-    {
-        juce::dsp::Oscillator<float> bodyOscillator;
-        juce::Random noiseGenerator;
-
-        bool isPlaying = false;
-        float envelopeTime = 0.0f;
-        float velocity = 0.0f;
-
-        void trigger(float velocityGain)
-        {
-            isPlaying = true;
-            envelopeTime = 0.0f;
-            velocity = velocityGain;
-        }
-
-        void stop()
-        {
-            isPlaying = false;
-            envelopeTime = 0.0f;
-        }
-    };
-
-    // Hi-Hat Voice structure (shared by Closed and Open)
-    struct HiHatVoice
-    {
-        // 6 square wave oscillators for metallic inharmonic spectrum
-        juce::dsp::Oscillator<float> oscillators[6];
-        juce::dsp::StateVariableTPTFilter<float> filter;
-
-        bool isPlaying = false;
-        float envelopeTime = 0.0f;
-        float velocity = 0.0f;
-
-        void trigger(float velocityGain)
-        {
-            isPlaying = true;
-            envelopeTime = 0.0f;
-            velocity = velocityGain;
-        }
-
-        void stop()
-        {
-            isPlaying = false;
-            envelopeTime = 0.0f;
-        }
-    };
-
-    // Clap Voice structure (multi-trigger envelope + filtered noise)
-    enum class ClapEnvelopeState { Spike1, Spike2, Spike3, Decay, Idle };
-
-    struct ClapVoice
-    {
-        juce::dsp::StateVariableTPTFilter<float> bandpassFilter;
-        ClapEnvelopeState envelopeState = ClapEnvelopeState::Idle;
-        int envelopeSample = 0;
-        float velocity = 0.0f;
-        bool isPlaying = false;
-
-        // Sample-rate independent timing (calculated in prepareToPlay)
-        int spike2StartSample = 0;
-        int spike3StartSample = 0;
-        int decayStartSample = 0;
-
-        void trigger(float velocityGain)
-        {
-            isPlaying = true;
-            envelopeState = ClapEnvelopeState::Spike1;
-            envelopeSample = 0;
-            velocity = velocityGain;
-        }
-
-        void stop()
-        {
-            isPlaying = false;
-            envelopeState = ClapEnvelopeState::Idle;
-            envelopeSample = 0;
-        }
-    };
+    // Voice order matches the individual output buses (bus 1..6)
+    enum VoiceIndex { kickVoice, lowTomVoice, midTomVoice, clapVoice, closedHatVoice, openHatVoice, numVoices };
+
+    // Render all voices into their scratch channels for [startSample, startSample + numSamples)
+    void renderVoices(int startSample, int numSamples);
+
+    // Copy/sum the rendered voices into every enabled output bus, panned
+    void writeOutputBuses(juce::AudioBuffer<float>& buffer);
+
+    bool anyVoicePlaying() const;
 
     // DSP Components (BEFORE APVTS for initialization order)
-    juce::dsp::ProcessSpec spec;
     TomVoice lowTom;
     TomVoice midTom;
     KickVoice kick;
@@ -159,7 +65,18 @@ private:
     HiHatVoice openHat;
     ClapVoice clap;
 
+    // Mono per-voice scratch (one channel per VoiceIndex)
+    juce::AudioBuffer<float> voiceBuffer;
+    std::array<bool, numVoices> voiceRendered {};
+    std::array<std::array<float, 2>, numVoices> panGains {};  // L, R per voice (per block)
+
+    // Idle-instance fast path (no voices, no note-ons → skip the block)
+    pfs::SilenceTracker silence;
+
     double currentSampleRate = 44100.0;
 
+    // Base seed for the kick click / clap noise streams (deterministic renders)
+    static constexpr uint64_t noiseSeed = 0x0808;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Drum808AudioProcessor)
 };
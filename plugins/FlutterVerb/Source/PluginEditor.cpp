@@ -172,9 +172,8 @@ void FlutterVerbAudioProcessorEditor::timerCallback()
     if (!webView)
         return;
 
-    // Read peak level from audio processor (atomic, thread-safe)
-    // Value is already in dB format
-    float dbLevel = audioProcessor.getCurrentOutputLevel();
+    // Highest true peak (dB) since the last frame, from the meter's lock-free history
+    float dbLevel = audioProcessor.getOutputMeter().readSince(meterPosition).truePeakDb;
 
     // Emit event to JavaScript (only if WebView is visible)
     webView->emitEventIfBrowserIsVisible("updateVUMeter", dbLevel);
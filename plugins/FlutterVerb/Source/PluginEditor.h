@@ -46,6 +46,7 @@ private:
 
     // Reference to audio processor
     FlutterVerbAudioProcessor& audioProcessor;
+    juce::uint64 meterPosition = 0;  // Read cursor into the processor's meter history
 
     // ========================================================================
     // ⚠️ CRITICAL MEMBER DECLARATION ORDER ⚠️
@@ -66,6 +66,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout FlutterVerbAudioProcessor::c
         false  // Default: WET ONLY (0)
     ));
 
+    // DRIVE_QUALITY - Anti-aliasing of the drive stage
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "DRIVE_QUALITY", 1 },
+        "Drive Quality",
+        juce::StringArray { "ADAA", "2x Oversampling", "4x Oversampling" },
+        0
+    ));
+
+    // REVERB_MODE - Algorithmic FDN or loaded impulse response
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "REVERB_MODE", 1 },
+        "Reverb Mode",
+        juce::StringArray { "Algorithmic", "Impulse Response" },
+        0
+    ));
+
     return layout;
 }
 
@@ -95,14 +111,13 @@ void FlutterVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     dryWetMixer.prepare(spec);
     dryWetMixer.reset();
 
-    // Fix 2: Set wet path latency compensation for modulation delay (50ms base delay)
-    float baseDelayMs = 50.0f;
-    int latencySamples = static_cast<int>((baseDelayMs / 1000.0f) * sampleRate);
-    dryWetMixer.setWetLatency(latencySamples);
+    // The dry path is delayed by the drive latency only (updateDriveLatency);
+    // the 50ms wow/flutter delay stays on the wet path as pre-delay
 
-    // Prepare reverb with ProcessSpec
-    reverb.prepare(spec);
-    reverb.reset();
+    // Prepare reverb (FDN, and the convolution: rebuilds a loaded IR at the new rate)
+    reverb.prepare(sampleRate, samplesPerBlock, isImpulseResponseSelected());
+    reverb.setDamping(reverbDamping);
+    reverb.setModulation(reverbModulation);
 
     // Phase 4.2: Prepare modulation system
     modulationDelay.prepare(spec);
@@ -113,10 +128,68 @@ void FlutterVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     wowPhase.resize(spec.numChannels, 0.0f);
     flutterPhase.resize(spec.numChannels, 0.0f);
 
-    // Phase 4.3: Prepare filter
+    // Phase 4.3: Prepare drive (both oversamplers built here, so DRIVE_QUALITY
+    // can change without allocating) and filter
+    driveStage.prepare(spec);
+    updateDriveLatency();
+
     toneFilter.prepare(spec);
     toneFilter.reset();
     currentFilterType = FilterType::None;
+
+    // Hold covers the longest internal delay (50ms wow/flutter + FDN line) so a
+    // gap between output echoes is not mistaken for the end of the tail
+    silence.prepare(sampleRate, 0.25, -120.0f);
+
+    // Phase 5.3: Output meter (the editor shows true peak only)
+    outputMeter.prepare(sampleRate, getTotalNumOutputChannels(), pfs::LevelMeter::Measurements::peaksOnly);
+}
+
+double FlutterVerbAudioProcessor::getTailLengthSeconds() const
+{
+    // IR mode: the (trimmed) impulse response plus the 50ms modulation delay
+    if (reverb.isUsingImpulseResponse(isImpulseResponseSelected()))
+        return reverb.getImpulseResponseSeconds() + 0.05;
+
+    // DECAY is the RT60: two of them take a full-scale tail down to -120 dBFS
+    const double decaySeconds = parameters.getRawParameterValue("DECAY")->load();
+    return 2.0 * decaySeconds + 0.05 + pfs::FdnReverb8::getMaxDelaySeconds();
+}
+
+bool FlutterVerbAudioProcessor::isImpulseResponseSelected() const
+{
+    return parameters.getRawParameterValue("REVERB_MODE")->load() > 0.5f;
+}
+
+void FlutterVerbAudioProcessor::loadImpulseResponse(const juce::File& file)
+{
+    reverb.loadImpulseResponse(file);
+}
+
+void FlutterVerbAudioProcessor::updateDriveLatency()
+{
+    driveStage.setQuality(static_cast<pfs::DriveStage::Quality>(
+        static_cast<int>(parameters.getRawParameterValue("DRIVE_QUALITY")->load())));
+
+    // The oversampling latency delays the whole output in both routings:
+    // WET+DRY drives the signal before the dry split; WET ONLY drives the
+    // reverb return, so the dry path is delayed to match
+    const bool wetDryMode = parameters.getRawParameterValue("MOD_MODE")->load() > 0.5f;
+    const int latency = driveStage.getLatencySamples();
+    dryWetMixer.setWetLatency(wetDryMode ? 0.0f : static_cast<float>(latency));
+
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+}
+
+void FlutterVerbAudioProcessor::resetTailState()
+{
+    reverb.reset();
+    modulationDelay.reset();
+    toneFilter.reset();
+    currentFilterType = FilterType::None;
+    driveStage.reset();
+    dryWetMixer.reset();
 }
 
 void FlutterVerbAudioProcessor::releaseResources()
@@ -133,6 +206,16 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    // Tail sleep: silent input and a finished tail - nothing to run
+    const bool inputActive = ! silence.isBelowThreshold(buffer);
+
+    if (silence.isIdle(inputActive, midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        outputMeter.processSilence(buffer.getNumSamples());
+        return;
+    }
+
     // Phase 4.1: Read SIZE, DECAY, MIX parameters (atomic, real-time safe)
     auto* sizeParam = parameters.getRawParameterValue("SIZE");
     auto* decayParam = parameters.getRawParameterValue("DECAY");
@@ -156,27 +239,13 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     auto* modModeParam = parameters.getRawParameterValue("MOD_MODE");
     bool wetDryMode = modModeParam->load() > 0.5f;  // 0=WET_ONLY, 1=WET_DRY
 
-    // Configure reverb parameters with true SIZE/DECAY independence
-    juce::Reverb::Parameters reverbParams;
-
-    // Map SIZE to base room size: 0-100% → 0.2-0.6 (ensures minimum space for reverb)
-    float baseRoomSize = 0.2f + (sizeValue * 0.4f);
-
-    // Map DECAY to multiplier: 0.1-10s → 0.5-2.0x (scales effective room size for tail length)
-    float decayMultiplier = juce::jmap(decayValue, 0.1f, 10.0f, 0.5f, 2.0f);
-
-    // Combine: roomSize affected by both SIZE and DECAY, clamped to valid range
-    reverbParams.roomSize = juce::jlimit(0.1f, 1.0f, baseRoomSize * decayMultiplier);
+    // Drive quality and the latency it adds in the current routing
+    updateDriveLatency();
 
-    // Keep damping for frequency-dependent absorption (complementary control)
-    reverbParams.damping = juce::jmap(decayValue, 0.1f, 10.0f, 0.95f, 0.05f);
-
-    reverbParams.width = 1.0f;         // Full stereo
-    reverbParams.freezeMode = 0.0f;    // No freeze
-    reverbParams.wetLevel = 1.0f;      // Full wet (mixer handles blend)
-    reverbParams.dryLevel = 0.0f;      // No dry (mixer handles blend)
-
-    reverb.setParameters(reverbParams);
+    // SIZE scales the delay-line lengths (room dimensions); DECAY is the RT60
+    // itself, so the two stay independent
+    reverb.setSize(sizeValue);
+    reverb.setDecaySeconds(decayValue);
 
     // Set dry/wet mix proportion
     dryWetMixer.setWetMixProportion(mixValue);
@@ -252,24 +321,20 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
     // Define DRIVE processing lambda for reusability
     auto applyDrive = [&]() {
+        juce::dsp::AudioBlock<float> driveBlock(buffer);
+
         if (driveValue > 0.0f)  // Only apply if DRIVE > 0
         {
             // Calculate gain: 1.0 at DRIVE=0%, 10.0 at DRIVE=100%
             float gain = 1.0f + (driveValue * 9.0f);
 
-            const int numChannels = buffer.getNumChannels();
-            const int numSamples = buffer.getNumSamples();
-
-            for (int channel = 0; channel < numChannels; ++channel)
-            {
-                auto* channelData = buffer.getWritePointer(channel);
-
-                for (int sample = 0; sample < numSamples; ++sample)
-                {
-                    // Apply tanh saturation
-                    channelData[sample] = std::tanh(gain * channelData[sample]);
-                }
-            }
+            // tanh(gain * x), alias-suppressed by ADAA or oversampling
+            driveStage.process(driveBlock, gain);
+        }
+        else
+        {
+            // Clean, but with the same latency as when driving
+            driveStage.processBypassed(driveBlock);
         }
     };
 
@@ -341,9 +406,8 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Push dry samples (processed in Mode 1, clean in Mode 0)
     dryWetMixer.pushDrySamples(block);
 
-    // Process reverb using modern DSP API
-    juce::dsp::ProcessContextReplacing<float> context(block);
-    reverb.process(context);
+    // Process reverb (wet only, in place): FDN or impulse response
+    reverb.process(buffer, isImpulseResponseSelected(), isNonRealtime());
 
     if (!wetDryMode)
     {
@@ -356,23 +420,15 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
     // Mix dry and wet samples
     dryWetMixer.mixWetSamples(block);
 
-    // Fix 5: Calculate peak level for VU meter (after all DSP processing)
-    // Store in dB format directly (like TapeAge pattern)
-    float peakLevel = 0.0f;
-    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
-    {
-        const float* channelData = buffer.getReadPointer(channel);
-        for (int sample = 0; sample < buffer.getNumSamples(); ++sample)
-        {
-            peakLevel = juce::jmax(peakLevel, std::abs(channelData[sample]));
-        }
-    }
+    // Fix 5: Meter the output (after all DSP processing)
+    outputMeter.process(buffer);
+
+    // Once the tail is below -120 dBFS, flush every stage so the next block
+    // with input starts clean and the blocks in between can be skipped
+    silence.trackTail(buffer, inputActive);
 
-    // Convert to dB and store atomically (clamp to -100dB minimum to avoid log(0))
-    float peakDb = peakLevel > 0.00001f
-        ? juce::Decibels::gainToDecibels(peakLevel)
-        : -100.0f;
-    outputLevel.store(peakDb, std::memory_order_relaxed);
+    if (silence.tailJustEnded())
+        resetTailState();
 }
 
 juce::AudioProcessorEditor* FlutterVerbAudioProcessor::createEditor()
@@ -383,6 +439,10 @@ juce::AudioProcessorEditor* FlutterVerbAudioProcessor::createEditor()
 void FlutterVerbAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
     auto state = parameters.copyState();
+
+    // Impulse response is referenced by path, not embedded
+    reverb.saveState(state);
+
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
 }
@@ -392,7 +452,14 @@ void FlutterVerbAudioProcessor::setStateInformation(const void* data, int sizeIn
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
-        parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+    {
+        auto state = juce::ValueTree::fromXml(*xmlState);
+        parameters.replaceState(state);
+
+        // Reload the impulse response: in the background, or before returning
+        // when rendering offline so the bounce starts with the IR in place
+        reverb.restoreState(state, isNonRealtime());
+    }
 }
 
 // Factory function
@@ -1,6 +1,10 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "DriveStage.h"
+#include "HybridReverb.h"
+#include "LevelMeter.h"
+#include "SilenceTracker.h"
 
 class FlutterVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -19,7 +23,7 @@ public:
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
     bool isMidiEffect() const override { return false; }
-    double getTailLengthSeconds() const override { return 0.0; }
+    double getTailLengthSeconds() const override;
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -33,13 +37,26 @@ public:
     // Public accessor for APVTS (required for WebView parameter binding)
     juce::AudioProcessorValueTreeState& getAPVTS() { return parameters; }
 
+    // Impulse response for REVERB_MODE = Impulse Response (loaded in the
+    // background, saved with the plugin state)
+    void loadImpulseResponse(const juce::File& file);
+
 private:
     // DSP Components (declare BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec spec;
 
-    // Phase 4.1: Core Reverb Processing
-    juce::dsp::Reverb reverb;
-    juce::dsp::DryWetMixer<float> dryWetMixer;
+    // Phase 4.1: Core Reverb Processing (8-line FDN, DECAY = RT60 in seconds, or
+    // the impulse response for REVERB_MODE = Impulse Response, crossfaded)
+    pfs::HybridReverb reverb;
+    static constexpr float reverbDamping = 0.4f;     // HF decays at 64% of DECAY (darker, tape-like tail)
+    static constexpr float reverbModulation = 0.3f;  // Subtle tap chorus against metallic ringing
+    juce::dsp::DryWetMixer<float> dryWetMixer { 256 };  // Max dry delay: the 4x oversampler's latency (WET ONLY)
+
+    bool isImpulseResponseSelected() const;  // Mode parameter; the FDN plays until an IR is loaded
+
+    // Tail sleep: skip all DSP once input is silent and the tail is below -120 dBFS
+    pfs::SilenceTracker silence;
+    void resetTailState();
 
     // Phase 4.2: Modulation System
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> modulationDelay { 9600 }; // 200ms at 48kHz
@@ -48,6 +65,8 @@ private:
     double currentSampleRate = 44100.0; // Store sample rate for LFO calculations
 
     // Phase 4.3: Saturation and Filter
+    pfs::DriveStage driveStage;  // ADAA or oversampled tanh (DRIVE_QUALITY)
+    void updateDriveLatency();   // Quality from DRIVE_QUALITY, host latency from MOD_MODE routing
     juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> toneFilter;
     enum class FilterType { None, LowPass, HighPass };
     FilterType currentFilterType = FilterType::None;
@@ -55,17 +74,15 @@ private:
     // APVTS comes AFTER DSP components
     juce::AudioProcessorValueTreeState parameters;
 
-    // Phase 5.3: VU Meter output level tracking (atomic for thread safety)
-    // Fix 5: Store level in dB (like TapeAge) instead of linear gain
-    std::atomic<float> outputLevel { -100.0f };  // Peak level in dB (initialized to silence)
+    // Phase 5.3: VU Meter output metering (lock-free history the editor reads)
+    pfs::LevelMeter outputMeter;
 
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
 public:
     // VU meter accessor (UI thread reads, audio thread writes)
-    // Fix 5: Returns dB value directly
-    float getCurrentOutputLevel() const { return outputLevel.load(std::memory_order_relaxed); }
+    const pfs::LevelMeter& getOutputMeter() const { return outputMeter; }
 
 private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlutterVerbAudioProcessor)
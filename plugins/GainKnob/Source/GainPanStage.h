@@ -0,0 +1,251 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Gain, per-channel trim and pan for every layout GainKnob accepts: mono up
+// to 7.1.4, or ambisonics up to third order (ACN; SN3D and N3D alike).
+//
+// Speaker layouts: each channel sits at a lateral position x (-1 left, +1
+// right, 0 for centre, LFE and the median-plane heights) and pans with
+//
+//   g(x, p) = cos(pi/4 * (1 - p * x))      p = pan, -1 .. +1
+//
+// which is the stereo constant-power law for x = -1 / +1. A mirrored pair
+// (x, -x) always sums to unit power and centre channels hold the law's -3dB
+// centre level, so a symmetric layout's total power does not move with pan.
+// Layouts without lateral channels (mono) ignore pan.
+//
+// Ambisonics: pan rotates the sound field about the vertical axis (hard left
+// = +90 degrees azimuth). The rotation mixes each (l, m) / (l, -m) pair and
+// leaves the field's energy unchanged.
+//
+// Each channel's gain (master * trim * pan) ramps per sample through its own
+// SmoothedValue and is applied with FloatVectorOperations::multiply; a steady
+// channel costs one scalar vector multiply, a clear, or nothing at unity.
+// No allocation after prepare().
+class GainPanStage
+{
+public:
+    static constexpr int maxChannels = 16;         // Third-order ambisonics
+    static constexpr int maxSpeakerChannels = 12;  // 7.1.4
+    static constexpr int maxAmbisonicOrder = 3;
+    static constexpr double rampSeconds = 0.02;
+
+    static bool isLayoutSupported(const juce::AudioChannelSet& layout)
+    {
+        if (layout.isDisabled())
+            return false;
+
+        const int order = layout.getAmbisonicOrder();
+
+        if (order >= 0)
+            return order <= maxAmbisonicOrder;
+
+        return ! layout.isDiscreteLayout() && layout.size() <= maxSpeakerChannels;
+    }
+
+    // Message thread, audio stopped (allocates)
+    void prepare(const juce::AudioChannelSet& layout, double sampleRate, int maximumBlockSize)
+    {
+        numChannels = juce::jlimit(0, maxChannels, layout.size());
+        ambisonicOrder = layout.getAmbisonicOrder();
+        hasLateralChannels = false;
+
+        for (int ch = 0; ch < maxChannels; ++ch)
+        {
+            const float x = ch < numChannels && ambisonicOrder < 0 ? lateralPosition(layout.getTypeOfChannel(ch)) : 0.0f;
+            positions[static_cast<size_t>(ch)] = x;
+            hasLateralChannels = hasLateralChannels || x != 0.0f;
+        }
+
+        for (auto& gain : gains)
+            gain.reset(sampleRate, rampSeconds);
+
+        azimuth.reset(sampleRate, rampSeconds);
+
+        const auto blockSize = static_cast<size_t>(juce::jmax(1, maximumBlockSize));
+        ramp.assign(blockSize, 0.0f);
+        scratch.assign(blockSize, 0.0f);
+        snapToTargets = true;
+    }
+
+    // Audio thread, once per block. gain is linear, pan -1 (left) .. +1
+    // (right), trims one linear gain per channel. The first call after
+    // prepare() jumps straight to the targets.
+    void setTargets(float gain, float pan, const float* trims)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const float panGain = hasLateralChannels ? panLaw(positions[static_cast<size_t>(ch)], pan) : 1.0f;
+            setTarget(gains[static_cast<size_t>(ch)], gain * trims[ch] * panGain);
+        }
+
+        if (ambisonicOrder > 0)
+            setTarget(azimuth, -pan * juce::MathConstants<float>::halfPi);
+
+        snapToTargets = false;
+    }
+
+    // Audio thread, in place
+    void process(juce::AudioBuffer<float>& buffer, int numSamples)
+    {
+        const int channels = juce::jmin(numChannels, buffer.getNumChannels());
+        const int chunkSize = static_cast<int>(ramp.size());
+
+        for (int start = 0; start < numSamples; start += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - start);
+
+            if (ambisonicOrder > 0 && channels == (ambisonicOrder + 1) * (ambisonicOrder + 1))
+                rotate(buffer, start, count);
+
+            for (int ch = 0; ch < channels; ++ch)
+                applyGain(buffer.getWritePointer(ch, start), gains[static_cast<size_t>(ch)], count);
+        }
+    }
+
+private:
+    static float panLaw(float position, float pan)
+    {
+        return std::cos(juce::MathConstants<float>::pi * 0.25f * (1.0f - pan * position));
+    }
+
+    static float lateralPosition(juce::AudioChannelSet::ChannelType type)
+    {
+        using Set = juce::AudioChannelSet;
+
+        switch (type)
+        {
+            case Set::left:
+            case Set::leftSurround:
+            case Set::leftSurroundSide:
+            case Set::leftSurroundRear:
+            case Set::wideLeft:
+            case Set::topFrontLeft:
+            case Set::topSideLeft:
+            case Set::topRearLeft:
+                return -1.0f;
+
+            case Set::right:
+            case Set::rightSurround:
+            case Set::rightSurroundSide:
+            case Set::rightSurroundRear:
+            case Set::wideRight:
+            case Set::topFrontRight:
+            case Set::topSideRight:
+            case Set::topRearRight:
+                return 1.0f;
+
+            case Set::leftCentre:  return -0.5f;
+            case Set::rightCentre: return 0.5f;
+
+            default:
+                return 0.0f;  // Centre, LFE, centre heights, surround centre
+        }
+    }
+
+    void setTarget(juce::SmoothedValue<float>& value, float target)
+    {
+        if (snapToTargets)
+            value.setCurrentAndTargetValue(target);
+        else
+            value.setTargetValue(target);
+    }
+
+    void applyGain(float* samples, juce::SmoothedValue<float>& gain, int count)
+    {
+        if (gain.isSmoothing())
+        {
+            for (int i = 0; i < count; ++i)
+                ramp[static_cast<size_t>(i)] = gain.getNextValue();
+
+            juce::FloatVectorOperations::multiply(samples, ramp.data(), count);
+            return;
+        }
+
+        const float target = gain.getTargetValue();
+
+        if (target == 0.0f)
+            juce::FloatVectorOperations::clear(samples, count);
+        else if (target != 1.0f)
+            juce::FloatVectorOperations::multiply(samples, target, count);
+    }
+
+    // Yaw rotation by the azimuth: for each order l and 0 < m <= l,
+    //   (l, m)  <- cos(m a) (l, m) - sin(m a) (l, -m)
+    //   (l, -m) <- cos(m a) (l, -m) + sin(m a) (l, m)
+    // with ACN index l * l + l + m
+    void rotate(juce::AudioBuffer<float>& buffer, int start, int count)
+    {
+        if (! azimuth.isSmoothing())
+        {
+            const float angle = azimuth.getTargetValue();
+
+            if (angle == 0.0f)
+                return;
+
+            for (int m = 1; m <= ambisonicOrder; ++m)
+            {
+                const float c = std::cos(static_cast<float>(m) * angle);
+                const float s = std::sin(static_cast<float>(m) * angle);
+
+                for (int l = m; l <= ambisonicOrder; ++l)
+                {
+                    float* plus = buffer.getWritePointer(l * l + l + m, start);
+                    float* minus = buffer.getWritePointer(l * l + l - m, start);
+
+                    juce::FloatVectorOperations::copy(scratch.data(), plus, count);
+                    juce::FloatVectorOperations::multiply(plus, c, count);
+                    juce::FloatVectorOperations::addWithMultiply(plus, minus, -s, count);
+                    juce::FloatVectorOperations::multiply(minus, c, count);
+                    juce::FloatVectorOperations::addWithMultiply(minus, scratch.data(), s, count);
+                }
+            }
+
+            return;
+        }
+
+        // Ramping: per sample, with cos / sin(m a) as powers of e^(i a)
+        std::array<float*, maxChannels> data {};
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            data[static_cast<size_t>(ch)] = buffer.getWritePointer(ch, start);
+
+        for (int i = 0; i < count; ++i)
+        {
+            const float angle = azimuth.getNextValue();
+            const float c1 = std::cos(angle), s1 = std::sin(angle);
+            float c = c1, s = s1;
+
+            for (int m = 1; m <= ambisonicOrder; ++m)
+            {
+                for (int l = m; l <= ambisonicOrder; ++l)
+                {
+                    float& plus = data[static_cast<size_t>(l * l + l + m)][i];
+                    float& minus = data[static_cast<size_t>(l * l + l - m)][i];
+                    const float p = plus;
+                    plus = c * p - s * minus;
+                    minus = c * minus + s * p;
+                }
+
+                const float next = c * c1 - s * s1;
+                s = s * c1 + c * s1;
+                c = next;
+            }
+        }
+    }
+
+    int numChannels = 0;
+    int ambisonicOrder = -1;  // -1 for speaker layouts
+    bool hasLateralChannels = false;
+    bool snapToTargets = true;
+
+    std::array<float, maxChannels> positions {};
+    std::array<juce::SmoothedValue<float>, maxChannels> gains;
+    juce::SmoothedValue<float> azimuth;  // Radians, ambisonics only
+
+    std::vector<float> ramp;     // One channel's gain ramp (one chunk)
+    std::vector<float> scratch;  // Rotation: copy of the (l, m) channel
+};
@@ -33,6 +33,19 @@ juce::AudioProcessorValueTreeState::ParameterLayout GainKnobAudioProcessor::crea
         "%"
     ));
 
+    // TRIM_1 .. TRIM_16 - Float parameters (-12.0 to +12.0 dB), one per channel
+    // of the bus layout (speaker order, or ACN order for ambisonics)
+    for (int channel = 1; channel <= GainPanStage::maxChannels; ++channel)
+    {
+        layout.add(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID { "TRIM_" + juce::String(channel), 1 },
+            "Trim " + juce::String(channel),
+            juce::NormalisableRange<float>(-12.0f, 12.0f, 0.1f, 1.0f),
+            0.0f,
+            "dB"
+        ));
+    }
+
     return layout;
 }
 
@@ -42,6 +55,12 @@ GainKnobAudioProcessor::GainKnobAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    gainParam = parameters.getRawParameterValue("GAIN");
+    panParam = parameters.getRawParameterValue("PAN");
+    filterParam = parameters.getRawParameterValue("FILTER");
+
+    for (size_t channel = 0; channel < trimParams.size(); ++channel)
+        trimParams[channel] = parameters.getRawParameterValue("TRIM_" + juce::String(static_cast<int>(channel) + 1));
 }
 
 GainKnobAudioProcessor::~GainKnobAudioProcessor()
@@ -58,6 +77,9 @@ void GainKnobAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 
     filterProcessor.prepare(spec);
     filterProcessor.reset();
+    coefficientsValid = false;
+
+    gainPan.prepare(getChannelLayoutOfBus(false, 0), sampleRate, samplesPerBlock);
 }
 
 void GainKnobAudioProcessor::releaseResources()
@@ -65,26 +87,62 @@ void GainKnobAudioProcessor::releaseResources()
     // Cleanup will be added in Stage 4
 }
 
+bool GainKnobAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // Any speaker layout from mono to 7.1.4, or ambisonics up to third order;
+    // input and output must match
+    const auto mainLayout = layouts.getMainOutputChannelSet();
+
+    return mainLayout == layouts.getMainInputChannelSet() && GainPanStage::isLayoutSupported(mainLayout);
+}
+
+void GainKnobAudioProcessor::updateFilterCoefficients(float filterPercent)
+{
+    if (coefficientsValid && filterPercent == coefficientsFilterPercent)
+        return;
+
+    float sampleRate = static_cast<float>(getSampleRate());
+
+    // ArrayCoefficients + assignment write into the existing coefficient
+    // storage, so moving the knob never allocates on the audio thread
+    if (filterPercent < 0.0f) {
+        // Low-pass filter (negative values)
+        // Exponential mapping: -100% = 200Hz (heavy bass), 0% = 20kHz (bypass)
+        // Formula inverted: Start high at center, go low at extreme
+        float normalizedValue = std::abs(filterPercent) / 100.0f; // 0.0 to 1.0
+        float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(20000.0f / 200.0f));
+
+        *filterProcessor.state = juce::dsp::IIR::ArrayCoefficients<float>::makeLowPass(
+            sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f
+        );
+    } else {
+        // High-pass filter (positive values)
+        // Exponential mapping: 0% = 20Hz (bypass), +100% = 10kHz (heavy treble)
+        // Formula: Start low at center, go high at extreme
+        float normalizedValue = filterPercent / 100.0f; // 0.0 to 1.0
+        float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(10000.0f / 20.0f));
+
+        *filterProcessor.state = juce::dsp::IIR::ArrayCoefficients<float>::makeHighPass(
+            sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f
+        );
+    }
+
+    coefficientsFilterPercent = filterPercent;
+    coefficientsValid = true;
+}
+
 void GainKnobAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
 
-    // Read GAIN parameter (atomic read, real-time safe)
-    auto* gainParam = parameters.getRawParameterValue("GAIN");
+    // Read parameters (atomic reads, real-time safe)
     float gainDb = gainParam->load();
-
-    // Read PAN parameter (atomic read, real-time safe)
-    auto* panParam = parameters.getRawParameterValue("PAN");
     float panPercent = panParam->load();
-
-    // Read FILTER parameter (atomic read, real-time safe)
-    auto* filterParam = parameters.getRawParameterValue("FILTER");
     float filterPercent = filterParam->load();
 
     // Apply DJ-style filter (if not at center position)
     if (std::abs(filterPercent) > 0.5f) {
-        float sampleRate = static_cast<float>(getSampleRate());
         bool isLowPass = (filterPercent < 0.0f);
 
         // Reset filter state when switching between low-pass and high-pass
@@ -94,27 +152,7 @@ void GainKnobAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
         }
         previousWasLowPass = isLowPass;
 
-        if (isLowPass) {
-            // Low-pass filter (negative values)
-            // Exponential mapping: -100% = 200Hz (heavy bass), 0% = 20kHz (bypass)
-            // Formula inverted: Start high at center, go low at extreme
-            float normalizedValue = std::abs(filterPercent) / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(20000.0f / 200.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f
-            );
-        } else {
-            // High-pass filter (positive values)
-            // Exponential mapping: 0% = 20Hz (bypass), +100% = 10kHz (heavy treble)
-            // Formula: Start low at center, go high at extreme
-            float normalizedValue = filterPercent / 100.0f; // 0.0 to 1.0
-            float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(10000.0f / 20.0f));
-
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f
-            );
-        }
+        updateFilterCoefficients(filterPercent);
 
         // Process buffer through filter
         juce::dsp::AudioBlock<float> block(buffer);
@@ -141,23 +179,14 @@ void GainKnobAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
         gainLinear = juce::Decibels::decibelsToGain(gainDb);
     }
 
-    // Calculate pan coefficients using constant power panning
-    // Pan range: -100 (full left) to +100 (full right)
-    // At center (0), both channels are at 0.707 (-3dB) for equal power
-    float panNormalized = panPercent / 100.0f; // Convert to -1.0 to +1.0
-    float panRadians = (panNormalized * 0.25f + 0.25f) * juce::MathConstants<float>::pi;
-
-    float leftGain = std::cos(panRadians) * gainLinear;
-    float rightGain = std::sin(panRadians) * gainLinear;
-
-    // Apply gain and pan to stereo channels
-    int numChannels = buffer.getNumChannels();
+    for (size_t channel = 0; channel < trimGains.size(); ++channel)
+        trimGains[channel] = juce::Decibels::decibelsToGain(trimParams[channel]->load());
 
-    if (numChannels >= 1)
-        buffer.applyGain(0, 0, buffer.getNumSamples(), leftGain);
-
-    if (numChannels >= 2)
-        buffer.applyGain(1, 0, buffer.getNumSamples(), rightGain);
+    // Gain, trim and constant power pan per channel, ramped sample by sample
+    // Pan range: -100 (full left) to +100 (full right)
+    // At center (0), a stereo pair is at 0.707 (-3dB) per channel for equal power
+    gainPan.setTargets(gainLinear, panPercent / 100.0f, trimGains.data());
+    gainPan.process(buffer, buffer.getNumSamples());
 }
 
 juce::AudioProcessorEditor* GainKnobAudioProcessor::createEditor()
@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "GainPanStage.h"
+#include <array>
+#include <atomic>
 
 class GainKnobAudioProcessor : public juce::AudioProcessor
 {
@@ -11,6 +14,7 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -36,11 +40,26 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    // Cached parameter values (atomic reads on the audio thread)
+    std::atomic<float>* gainParam = nullptr;
+    std::atomic<float>* panParam = nullptr;
+    std::atomic<float>* filterParam = nullptr;
+    std::array<std::atomic<float>*, GainPanStage::maxChannels> trimParams {};
+
     // Filter state (per-channel)
     juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
 
+    // Coefficients are recomputed in place only when FILTER moves
+    void updateFilterCoefficients(float filterPercent);
+    float coefficientsFilterPercent = 0.0f;
+    bool coefficientsValid = false;
+
     // Track previous filter type to detect transitions
     bool previousWasLowPass = false;
 
+    // Gain, per-channel trim and pan for the bus layout (smoothed per sample)
+    GainPanStage gainPan;
+    std::array<float, GainPanStage::maxChannels> trimGains {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GainKnobAudioProcessor)
 };
@@ -0,0 +1,74 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cmath>
+
+// TPT state variable low-pass, mono. Same response as the 2-pole
+// juce::dsp::IIR::Coefficients::makeLowPass (prewarped bilinear) at equal
+// cutoff and Q, but its coefficient g can move every sample without clicks
+// or instability, so cutoff changes ramp linearly across a control-rate
+// sub-block. The tan() for a new cutoff happens once, in cutoffToG().
+struct LowpassSVF
+{
+    float g = 0.0f;
+    float R2 = 2.0f;
+    float h = 1.0f;
+    float s1 = 0.0f;
+    float s2 = 0.0f;
+
+    float gTarget = 0.0f;
+    float gStep = 0.0f;
+    int rampSamples = 0;
+
+    static float cutoffToG(float cutoffHz, double sampleRate)
+    {
+        const float nyquistSafe = static_cast<float>(sampleRate) * 0.49f;
+        const float cutoff = juce::jlimit(10.0f, nyquistSafe, cutoffHz);
+        return std::tan(juce::MathConstants<float>::pi * cutoff / static_cast<float>(sampleRate));
+    }
+
+    void setResonance(float q)
+    {
+        R2 = 1.0f / q;
+        updateH();
+    }
+
+    // Jump straight to a coefficient (voice start)
+    void setG(float newG)
+    {
+        g = gTarget = newG;
+        rampSamples = 0;
+        updateH();
+    }
+
+    // Reach newG after numSamples calls to process()
+    void rampG(float newG, int numSamples)
+    {
+        if (newG == gTarget)
+            return;
+
+        gTarget = newG;
+        rampSamples = juce::jmax(1, numSamples);
+        gStep = (gTarget - g) / static_cast<float>(rampSamples);
+    }
+
+    void reset() { s1 = s2 = 0.0f; }
+
+    inline float process(float x)
+    {
+        if (rampSamples > 0)
+        {
+            g = --rampSamples == 0 ? gTarget : g + gStep;
+            updateH();
+        }
+
+        const float yHP = h * (x - s1 * (g + R2) - s2);
+        const float yBP = yHP * g + s1;
+        s1 = yHP * g + yBP;
+        const float yLP = yBP * g + s2;
+        s2 = yBP * g + yLP;
+        return yLP;
+    }
+
+private:
+    void updateH() { h = 1.0f / (1.0f + R2 * g + g * g); }
+};
@@ -38,6 +38,9 @@ LushPadAudioProcessor::LushPadAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    timbreParam = parameters.getRawParameterValue("timbre");
+    filterCutoffParam = parameters.getRawParameterValue("filter_cutoff");
+    reverbAmountParam = parameters.getRawParameterValue("reverb_amount");
 }
 
 LushPadAudioProcessor::~LushPadAudioProcessor()
@@ -66,20 +69,23 @@ void LushPadAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     reverbParams.width = 1.0f;        // Full stereo width
     reverbParams.freezeMode = 0.0f;   // No freeze
     reverb.setParameters(reverbParams);
+    currentReverbAmount = -1.0f;
 
-    // Prepare DSP spec for mono per-voice filtering
-    juce::dsp::ProcessSpec voiceSpec;
-    voiceSpec.sampleRate = sampleRate;
-    voiceSpec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    voiceSpec.numChannels = 1;  // Mono per-voice
-
-    // Initialize all voices with filter preparation
+    // Initialize all voices (12dB/octave low-pass, Q=0.35)
     for (auto& voice : voices)
     {
         voice.adsr.setSampleRate(sampleRate);
-        voice.filter.prepare(voiceSpec);
+        voice.filter.setResonance(0.35f);
         voice.reset();
     }
+
+    // LFO smoothing is a per-sample one-pole (coefficient 0.01); over n
+    // samples with a held target it closes 1 - 0.99^n of the gap
+    for (size_t length = 0; length < lfoSmoothing.size(); ++length)
+        lfoSmoothing[length] = 1.0f - std::pow(0.99f, static_cast<float>(length));
+
+    // Hold longer than the longest Freeverb comb so a quiet gap is not mistaken for the end
+    silence.prepare(sampleRate, 0.2);
 }
 
 void LushPadAudioProcessor::releaseResources()
@@ -87,13 +93,18 @@ void LushPadAudioProcessor::releaseResources()
     // Cleanup will be added in Stage 3 (DSP)
 }
 
-void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
+void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice, int numSamples)
 {
+    // Advanced once per sub-block: the LFOs run at 0.01-0.26 Hz, so holding
+    // each target across numSamples is inaudible
+    const float radiansPerHz = juce::MathConstants<float>::twoPi * static_cast<float>(numSamples) / static_cast<float>(currentSampleRate);
+    const float smoothing = lfoSmoothing[static_cast<size_t>(numSamples)];
+
     // Update tertiary LFOs first (indices 6-8) - slowest layer, modulate primary depths
     for (int i = 0; i < 3; ++i)
     {
         int lfoIndex = 6 + i;
-        float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+        float phaseIncrement = voice.lfoBaseFreq[lfoIndex] * radiansPerHz;
         voice.lfoPhase[lfoIndex] += phaseIncrement;
 
         // Wrap phase
@@ -104,14 +115,14 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
         float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
 
         // One-pole low-pass filter for smoothing
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * smoothing;
     }
 
     // Update secondary LFOs (indices 3-5) - middle layer, modulate primary speeds
     for (int i = 0; i < 3; ++i)
     {
         int lfoIndex = 3 + i;
-        float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+        float phaseIncrement = voice.lfoBaseFreq[lfoIndex] * radiansPerHz;
         voice.lfoPhase[lfoIndex] += phaseIncrement;
 
         // Wrap phase
@@ -120,7 +131,7 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
 
         // Generate smooth random value
         float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * smoothing;
     }
 
     // Update primary LFOs (indices 0-2) - fastest layer, modulated by secondary and tertiary
@@ -134,7 +145,7 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
         float speedMod = 1.0f + (voice.lfoSmoothed[secondaryIndex] * 0.3f);
         float modulatedFreq = voice.lfoBaseFreq[lfoIndex] * speedMod;
 
-        float phaseIncrement = (modulatedFreq * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+        float phaseIncrement = modulatedFreq * radiansPerHz;
         voice.lfoPhase[lfoIndex] += phaseIncrement;
 
         // Wrap phase
@@ -146,7 +157,7 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
 
         // Generate smooth random value with modulated depth
         float targetValue = std::sin(voice.lfoPhase[lfoIndex]) * depthMod;
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * smoothing;
     }
 }
 
@@ -156,6 +167,13 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
+    // Idle instance: no voice sounding, reverb tail finished, nothing to trigger
+    if (silence.isIdle(anyVoiceActive(), midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        return;
+    }
+
     // Clear output buffer
     buffer.clear();
 
@@ -178,62 +196,137 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     }
 
     // Read parameters (atomic, done once per buffer for efficiency)
-    float timbreValue = parameters.getRawParameterValue("timbre")->load();
-    float filterCutoffValue = parameters.getRawParameterValue("filter_cutoff")->load();
-    float reverbAmountValue = parameters.getRawParameterValue("reverb_amount")->load();
+    float timbreValue = timbreParam->load();
+    float filterCutoffValue = filterCutoffParam->load();
+    float reverbAmountValue = reverbAmountParam->load();
 
-    // Generate audio per-sample
+    // Generate audio per voice (skipped while only the reverb tail is ringing)
     const int numSamples = buffer.getNumSamples();
 
-    for (int sample = 0; sample < numSamples; ++sample)
+    if (anyVoiceActive())
     {
-        float mixL = 0.0f;
-        float mixR = 0.0f;
+        float* left = buffer.getWritePointer(0);
+        float* right = totalNumOutputChannels > 1 ? buffer.getWritePointer(1) : nullptr;
 
-        // Process all active voices
         for (auto& voice : voices)
         {
-            if (!voice.active)
-                continue;
-
-            // Update nested LFO system
-            updateVoiceLFOs(voice);
-
-            // Get LFO modulation values
-            float panModulation = voice.lfoSmoothed[0];    // LFO1: -1 to +1 (panning)
-            float fmModulation = voice.lfoSmoothed[1];     // LFO2: -1 to +1 (FM depth)
-            float satModulation = voice.lfoSmoothed[2];    // LFO3: -1 to +1 (saturation)
-
-            // Calculate modulated FM feedback depth
-            float baseFeedbackDepth = timbreValue * 0.4f;
-            float modulatedFeedback = baseFeedbackDepth * (1.0f + fmModulation * 0.2f);  // ±20%
-            modulatedFeedback = juce::jlimit(0.0f, 0.4f, modulatedFeedback);
-
-            // Calculate modulated saturation gain
-            float baseSaturationGain = 1.0f + (timbreValue * 2.0f);
-            float modulatedSaturation = baseSaturationGain * (1.0f + satModulation * 0.15f);  // ±15%
-            modulatedSaturation = juce::jlimit(1.0f, 3.0f, modulatedSaturation);
-
-            // Calculate pan position (0.0 = left, 0.5 = center, 1.0 = right)
-            float panValue = 0.5f + (panModulation * 0.3f);  // ±30% from center
-            panValue = juce::jlimit(0.0f, 1.0f, panValue);
-
-            // Calculate base frequency for this MIDI note
-            // f = 440 * 2^((note - 69) / 12)
-            float baseFreq = 440.0f * std::pow(2.0f, (voice.currentNote - 69) / 12.0f);
-
-            // Detuning ratios
-            // +7 cents: 2^(7/1200) ≈ 1.00407
-            // -7 cents: 2^(-7/1200) ≈ 0.99593
-            float ratio1 = 1.0f;       // Base frequency
-            float ratio2 = 1.00407f;   // +7 cents
-            float ratio3 = 0.99593f;   // -7 cents
+            if (voice.active)
+                renderVoice(voice, left, right, numSamples, timbreValue, filterCutoffValue);
+        }
+    }
+
+    // Apply global reverb with reverb_amount parameter controlling wet/dry
+    juce::dsp::AudioBlock<float> block(buffer);
+    juce::dsp::ProcessContextReplacing<float> context(block);
+
+    // Update reverb wet/dry levels when the parameter moves
+    if (reverbAmountValue != currentReverbAmount)
+    {
+        juce::dsp::Reverb::Parameters reverbParams;
+        reverbParams.roomSize = 0.9f;
+        reverbParams.damping = 0.4f;
+        reverbParams.wetLevel = reverbAmountValue;
+        reverbParams.dryLevel = 1.0f - reverbAmountValue;
+        reverbParams.width = 1.0f;
+        reverbParams.freezeMode = 0.0f;
+        reverb.setParameters(reverbParams);
+        currentReverbAmount = reverbAmountValue;
+    }
+
+    reverb.process(context);
+
+    // Once the tail has decayed below threshold, flush the reverb so the next
+    // note starts from a clean state and later blocks can be skipped
+    silence.trackTail(buffer, anyVoiceActive());
+
+    if (silence.tailJustEnded())
+        reverb.reset();
+}
+
+void LushPadAudioProcessor::renderVoice(SynthVoice& voice, float* left, float* right, int numSamples,
+                                        float timbre, float filterCutoff)
+{
+    // Calculate velocity-scaled filter cutoff
+    // Soft notes (low velocity): darker sound (cutoff reduced by 50%)
+    // Hard notes (high velocity): brighter sound (cutoff at parameter value)
+    float velocityScaledCutoff = filterCutoff * (0.5f + 0.5f * voice.currentVelocity);
+
+    // Clamp to valid range
+    velocityScaledCutoff = juce::jlimit(20.0f, 20000.0f, velocityScaledCutoff);
+
+    for (int start = 0; start < numSamples && voice.active; start += controlBlockSize)
+    {
+        const int count = juce::jmin(controlBlockSize, numSamples - start);
+
+        // Control rate: update nested LFO system
+        updateVoiceLFOs(voice, count);
+
+        // Get LFO modulation values
+        float panModulation = voice.lfoSmoothed[0];    // LFO1: -1 to +1 (panning)
+        float fmModulation = voice.lfoSmoothed[1];     // LFO2: -1 to +1 (FM depth)
+        float satModulation = voice.lfoSmoothed[2];    // LFO3: -1 to +1 (saturation)
+
+        // Calculate modulated FM feedback depth
+        float baseFeedbackDepth = timbre * 0.4f;
+        float modulatedFeedback = baseFeedbackDepth * (1.0f + fmModulation * 0.2f);  // ±20%
+        modulatedFeedback = juce::jlimit(0.0f, 0.4f, modulatedFeedback);
+
+        // Calculate modulated saturation gain
+        float baseSaturationGain = 1.0f + (timbre * 2.0f);
+        float modulatedSaturation = baseSaturationGain * (1.0f + satModulation * 0.15f);  // ±15%
+        modulatedSaturation = juce::jlimit(1.0f, 3.0f, modulatedSaturation);
+
+        // Calculate pan position (0.0 = left, 0.5 = center, 1.0 = right)
+        float panValue = 0.5f + (panModulation * 0.3f);  // ±30% from center
+        panValue = juce::jlimit(0.0f, 1.0f, panValue);
+
+        // LFO-modulated panning, with the voice mix gain folded in
+        float leftGain = (1.0f - panValue) * voiceMixGain;
+        float rightGain = panValue * voiceMixGain;
+
+        // First sub-block of a note starts at its targets; later ones ramp
+        // from where the previous sub-block ended
+        if (!voice.controlsPrimed)
+        {
+            voice.feedback = modulatedFeedback;
+            voice.saturation = modulatedSaturation;
+            voice.leftGain = leftGain;
+            voice.rightGain = rightGain;
+            voice.filter.setG(LowpassSVF::cutoffToG(velocityScaledCutoff, currentSampleRate));
+            voice.filterCutoff = velocityScaledCutoff;
+            voice.controlsPrimed = true;
+        }
+        else if (velocityScaledCutoff != voice.filterCutoff)
+        {
+            // New filter coefficient only when the cutoff moves
+            voice.filter.rampG(LowpassSVF::cutoffToG(velocityScaledCutoff, currentSampleRate), count);
+            voice.filterCutoff = velocityScaledCutoff;
+        }
+
+        const float inverseCount = 1.0f / static_cast<float>(count);
+        const float feedbackStep = (modulatedFeedback - voice.feedback) * inverseCount;
+        const float saturationStep = (modulatedSaturation - voice.saturation) * inverseCount;
+        const float leftStep = (leftGain - voice.leftGain) * inverseCount;
+        const float rightStep = (rightGain - voice.rightGain) * inverseCount;
+
+        float feedback = voice.feedback;
+        float saturation = voice.saturation;
+        float leftLevel = voice.leftGain;
+        float rightLevel = voice.rightGain;
+
+        // Audio rate: oscillators, saturation, filter, envelope
+        for (int sample = start; sample < start + count; ++sample)
+        {
+            feedback += feedbackStep;
+            saturation += saturationStep;
+            leftLevel += leftStep;
+            rightLevel += rightStep;
 
             // Generate 3 detuned sine oscillators WITH modulated FM feedback
-            // Formula: sin(phase + modulatedFeedback * previousOutput)
-            float osc1 = std::sin(voice.phase1 + modulatedFeedback * voice.previousOutput1);
-            float osc2 = std::sin(voice.phase2 + modulatedFeedback * voice.previousOutput2);
-            float osc3 = std::sin(voice.phase3 + modulatedFeedback * voice.previousOutput3);
+            // Formula: sin(phase + feedback * previousOutput)
+            float osc1 = std::sin(voice.phase1 + feedback * voice.previousOutput1);
+            float osc2 = std::sin(voice.phase2 + feedback * voice.previousOutput2);
+            float osc3 = std::sin(voice.phase3 + feedback * voice.previousOutput3);
 
             // Store outputs for next sample's feedback
             voice.previousOutput1 = osc1;
@@ -244,85 +337,54 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             float voiceOutput = (osc1 + osc2 + osc3) / 3.0f;
 
             // Apply modulated harmonic saturation using tanh waveshaping
-            voiceOutput = std::tanh(modulatedSaturation * voiceOutput);
-
-            // Calculate velocity-scaled filter cutoff
-            // Soft notes (low velocity): darker sound (cutoff reduced by 50%)
-            // Hard notes (high velocity): brighter sound (cutoff at parameter value)
-            float velocityScaledCutoff = filterCutoffValue * (0.5f + 0.5f * voice.currentVelocity);
-
-            // Clamp to valid range
-            velocityScaledCutoff = juce::jlimit(20.0f, 20000.0f, velocityScaledCutoff);
-
-            // Update filter coefficients (12dB/octave low-pass, Q=0.35)
-            auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate,
-                velocityScaledCutoff,
-                0.35f  // Fixed resonance
-            );
-            *voice.filter.coefficients = *coefficients;
+            voiceOutput = std::tanh(saturation * voiceOutput);
 
             // Process through filter
-            voiceOutput = voice.filter.processSample(voiceOutput);
+            voiceOutput = voice.filter.process(voiceOutput);
 
             // Apply ADSR envelope
-            float envelope = voice.adsr.getNextSample();
-            voiceOutput *= envelope * voice.currentVelocity;
-
-            // Apply LFO-modulated panning
-            float leftGain = 1.0f - panValue;
-            float rightGain = panValue;
+            voiceOutput *= voice.adsr.getNextSample() * voice.currentVelocity;
 
-            mixL += voiceOutput * leftGain;
-            mixR += voiceOutput * rightGain;
+            left[sample] += voiceOutput * leftLevel;
 
-            // Update oscillator phases
-            float phaseIncrement1 = (baseFreq * ratio1 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-            float phaseIncrement2 = (baseFreq * ratio2 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-            float phaseIncrement3 = (baseFreq * ratio3 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
+            if (right != nullptr)
+                right[sample] += voiceOutput * rightLevel;
 
-            voice.phase1 += phaseIncrement1;
-            voice.phase2 += phaseIncrement2;
-            voice.phase3 += phaseIncrement3;
+            // Update oscillator phases, wrapped to [0, 2π] to prevent denormals
+            voice.phase1 += voice.phaseIncrement1;
+            voice.phase2 += voice.phaseIncrement2;
+            voice.phase3 += voice.phaseIncrement3;
 
-            // Wrap phases to [0, 2π] to prevent denormals
-            while (voice.phase1 >= juce::MathConstants<float>::twoPi)
+            if (voice.phase1 >= juce::MathConstants<float>::twoPi)
                 voice.phase1 -= juce::MathConstants<float>::twoPi;
-            while (voice.phase2 >= juce::MathConstants<float>::twoPi)
+            if (voice.phase2 >= juce::MathConstants<float>::twoPi)
                 voice.phase2 -= juce::MathConstants<float>::twoPi;
-            while (voice.phase3 >= juce::MathConstants<float>::twoPi)
+            if (voice.phase3 >= juce::MathConstants<float>::twoPi)
                 voice.phase3 -= juce::MathConstants<float>::twoPi;
-
-            // Mark voice inactive if envelope has finished
-            if (!voice.adsr.isActive())
-            {
-                voice.active = false;
-            }
         }
 
-        // Write to output buffer (reduce gain to prevent clipping with 8 voices)
-        buffer.setSample(0, sample, mixL * 0.3f);
-        if (totalNumOutputChannels > 1)
-        {
-            buffer.setSample(1, sample, mixR * 0.3f);
-        }
-    }
+        // Land exactly on the targets (no drift from the running sums)
+        voice.feedback = modulatedFeedback;
+        voice.saturation = modulatedSaturation;
+        voice.leftGain = leftGain;
+        voice.rightGain = rightGain;
 
-    // Apply global reverb with reverb_amount parameter controlling wet/dry
-    juce::dsp::AudioBlock<float> block(buffer);
-    juce::dsp::ProcessContextReplacing<float> context(block);
+        // Mark voice inactive if envelope has finished (it outputs zeros
+        // from the sample it finished on)
+        if (!voice.adsr.isActive())
+            voice.active = false;
+    }
+}
 
-    // Update reverb wet/dry levels based on parameter
-    juce::dsp::Reverb::Parameters reverbParams;
-    reverbParams.roomSize = 0.9f;
-    reverbParams.damping = 0.4f;
-    reverbParams.wetLevel = reverbAmountValue;
-    reverbParams.dryLevel = 1.0f - reverbAmountValue;
-    reverbParams.width = 1.0f;
-    reverbParams.freezeMode = 0.0f;
-    reverb.setParameters(reverbParams);
+bool LushPadAudioProcessor::anyVoiceActive() const
+{
+    for (const auto& voice : voices)
+    {
+        if (voice.active)
+            return true;
+    }
 
-    reverb.process(context);
+    return false;
 }
 
 juce::AudioProcessorEditor* LushPadAudioProcessor::createEditor()
@@ -391,6 +453,19 @@ void LushPadAudioProcessor::startVoice(SynthVoice& voice, int note, float veloci
     voice.currentVelocity = velocity;
     voice.timestamp = voiceCounter++;
     voice.phase1 = voice.phase2 = voice.phase3 = 0.0f;
+    voice.controlsPrimed = false;
+
+    // Calculate base frequency for this MIDI note (pitch is fixed for the note)
+    // f = 440 * 2^((note - 69) / 12)
+    float baseFreq = 440.0f * std::pow(2.0f, (note - 69) / 12.0f);
+
+    // Detuning ratios
+    // +7 cents: 2^(7/1200) ≈ 1.00407
+    // -7 cents: 2^(-7/1200) ≈ 0.99593
+    float radiansPerHz = juce::MathConstants<float>::twoPi / static_cast<float>(currentSampleRate);
+    voice.phaseIncrement1 = baseFreq * 1.0f * radiansPerHz;      // Base frequency
+    voice.phaseIncrement2 = baseFreq * 1.00407f * radiansPerHz;  // +7 cents
+    voice.phaseIncrement3 = baseFreq * 0.99593f * radiansPerHz;  // -7 cents
 
     // Initialize random LFO base frequencies for this voice
     // Primary LFOs (0-2): 0.05-0.2 Hz
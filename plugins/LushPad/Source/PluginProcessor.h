@@ -1,6 +1,10 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "LowpassSVF.h"
+#include "SilenceTracker.h"
+#include <array>
+#include <atomic>
 
 class LushPadAudioProcessor : public juce::AudioProcessor
 {
@@ -49,13 +53,27 @@ private:
         float phase2 = 0.0f;  // +7 cents
         float phase3 = 0.0f;  // -7 cents
 
+        // Phase increments in radians per sample, fixed at note start
+        float phaseIncrement1 = 0.0f;
+        float phaseIncrement2 = 0.0f;
+        float phaseIncrement3 = 0.0f;
+
         // FM feedback memory (1-sample delay per oscillator)
         float previousOutput1 = 0.0f;
         float previousOutput2 = 0.0f;
         float previousOutput3 = 0.0f;
 
         // Low-pass filter per voice
-        juce::dsp::IIR::Filter<float> filter;
+        LowpassSVF filter;
+        float filterCutoff = 0.0f;  // Cutoff the filter's target coefficient was computed for
+
+        // Control-rate values reached at the end of the last sub-block; the
+        // next sub-block ramps from these to its own targets
+        float feedback = 0.0f;
+        float saturation = 1.0f;
+        float leftGain = 0.0f;
+        float rightGain = 0.0f;
+        bool controlsPrimed = false;  // False until the first sub-block sets them
 
         // Random LFO system (9 per voice)
         // Indices 0-2: Primary LFOs (panning, FM depth, saturation)
@@ -78,6 +96,8 @@ private:
             phase1 = phase2 = phase3 = 0.0f;
             previousOutput1 = previousOutput2 = previousOutput3 = 0.0f;
             filter.reset();
+            filterCutoff = 0.0f;
+            controlsPrimed = false;
             adsr.reset();
 
             // Reset LFOs
@@ -96,9 +116,26 @@ private:
     uint64_t voiceCounter = 0;  // Incrementing timestamp for oldest-note-stealing
     double currentSampleRate = 44100.0;
 
+    // Control rate: LFOs, modulation targets and filter coefficients update
+    // once per sub-block and ramp linearly across it; the per-sample loop is
+    // oscillator, saturation, filter and envelope arithmetic only
+    static constexpr int controlBlockSize = 32;
+    static constexpr float voiceMixGain = 0.3f;  // Headroom for 8 voices
+    std::array<float, controlBlockSize + 1> lfoSmoothing {};  // One-pole coefficient per sub-block length
+
+    // Cached parameter values (atomic reads on the audio thread)
+    std::atomic<float>* timbreParam = nullptr;
+    std::atomic<float>* filterCutoffParam = nullptr;
+    std::atomic<float>* reverbAmountParam = nullptr;
+    float currentReverbAmount = -1.0f;  // Reverb parameters are only pushed when this changes
+
     // Global reverb
     juce::dsp::Reverb reverb;
 
+    // Idle fast path: voices idle and reverb tail below -100 dBFS → skip the block
+    pfs::SilenceTracker silence;
+    bool anyVoiceActive() const;
+
     // Random number generator (for LFO frequency randomization)
     juce::Random random;
 
@@ -107,8 +144,11 @@ private:
     void releaseVoice(int note);
     void startVoice(SynthVoice& voice, int note, float velocity);
 
-    // LFO update (nested modulation)
-    void updateVoiceLFOs(SynthVoice& voice);
+    // LFO update (nested modulation), advanced by one sub-block
+    void updateVoiceLFOs(SynthVoice& voice, int numSamples);
+
+    // Renders one voice into the output, sub-block by sub-block
+    void renderVoice(SynthVoice& voice, float* left, float* right, int numSamples, float timbre, float filterCutoff);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LushPadAudioProcessor)
 };
@@ -81,6 +81,8 @@ void MinimalKickAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
 
     // Reset envelope
     envelope.reset();
+
+    silence.prepare(sampleRate, 0.05);
 }
 
 void MinimalKickAudioProcessor::releaseResources()
@@ -92,6 +94,13 @@ void MinimalKickAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 {
     juce::ScopedNoDenormals noDenormals;
 
+    // Idle instance: envelope finished and nothing to trigger
+    if (silence.isIdle(envelope.isActive(), midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        return;
+    }
+
     // Clear buffer (instrument starts with silence)
     buffer.clear();
 
@@ -193,6 +202,8 @@ void MinimalKickAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
             }
         }
     }
+
+    silence.trackTail(buffer, envelope.isActive());
 }
 
 juce::AudioProcessorEditor* MinimalKickAudioProcessor::createEditor()
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "SilenceTracker.h"
 
 class MinimalKickAudioProcessor : public juce::AudioProcessor
 {
@@ -48,6 +49,9 @@ private:
     float pitchEnvelopeValue { 0.0f };  // Normalized 0.0 to 1.0 (decays from 1.0 to 0.0)
     int pitchEnvelopeSampleCount { 0 };
 
+    // Idle-instance fast path (envelope finished, no note-on → skip the block)
+    pfs::SilenceTracker silence;
+
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MinimalKickAudioProcessor)
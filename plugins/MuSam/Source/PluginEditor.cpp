@@ -213,8 +213,7 @@ MuSamAudioProcessorEditor::MuSamAudioProcessorEditor(MuSamAudioProcessor& p)
                 if (var.isString())
                 {
                     juce::String logMsg = "MuSam [JS]: " + var.toString();
-                    juce::Logger::writeToLog(logMsg);
-                    writeDebugLog(logMsg);
+                    pfs::Trace::message("MuSam", logMsg);
                 }
             })
 
@@ -436,16 +435,14 @@ MuSamAudioProcessorEditor::MuSamAudioProcessorEditor(MuSamAudioProcessor& p)
     // TEST: Add parameter listener to log all parameter changes
     processorRef.parameters.addParameterListener("speed", this);
     processorRef.parameters.addParameterListener("volume", this);
-    writeDebugLog("MuSam: Parameter listeners added for speed and volume");
-    writeDebugLog("MuSam: Overlay DISABLED for testing - UI interactions should work now");
+    pfs::Trace::message("MuSam", "MuSam: Parameter listeners added for speed and volume");
+    pfs::Trace::message("MuSam", "MuSam: Overlay DISABLED for testing - UI interactions should work now");
     
     // Debug: Log WebView configuration
     juce::String logMsg = "MuSam: WebView configured, bounds: " + webView->getBounds().toString();
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     logMsg = "MuSam: Drag & Drop overlay created - will intercept drag events";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
 
     // ------------------------------------------------------------------------
     // WINDOW SIZE
@@ -471,30 +468,20 @@ MuSamAudioProcessorEditor::MuSamAudioProcessorEditor(MuSamAudioProcessor& p)
     
     // Debug: Log that editor is ready for drag & drop
     logMsg = "MuSam: Editor initialized, drag & drop enabled";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     logMsg = "MuSam: Editor bounds: " + getBounds().toString();
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     logMsg = "MuSam: Editor is FileDragAndDropTarget: true";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
-    // Clear old debug log on startup
-    juce::File logFile = juce::File::getSpecialLocation(juce::File::userHomeDirectory)
-                            .getChildFile("MuSam_debug.log");
-    if (logFile.existsAsFile())
-    {
-        logFile.deleteFile();
-    }
-    writeDebugLog("=== MuSam Debug Log Started ===");
+    pfs::Trace::message("MuSam", "=== MuSam Debug Log Started ===");
     
     // TEST: Start timer to verify logging works
     // This will log every 2 seconds to prove the logging system is functional
     startTimer(2000); // 2000ms = 2 seconds
-    writeDebugLog("MuSam: Debug timer started (logs every 2 seconds)");
+    pfs::Trace::message("MuSam", "MuSam: Debug timer started (logs every 2 seconds)");
 }
 
 //==============================================================================
@@ -532,8 +519,7 @@ void MuSamAudioProcessorEditor::timerCallback()
     static int counter = 0;
     counter++;
     juce::String logMsg = "MuSam: Timer tick #" + juce::String(counter) + " - Logging system is working!";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
 }
 
 //==============================================================================
@@ -545,8 +531,7 @@ void MuSamAudioProcessorEditor::mouseDown(const juce::MouseEvent& e)
     // TEST: Log mouse clicks to verify events reach the Editor
     juce::String logMsg = "MuSam: mouseDown event at (" + 
                           juce::String(e.x) + ", " + juce::String(e.y) + ")";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     // Call parent implementation
     AudioProcessorEditor::mouseDown(e);
@@ -558,13 +543,9 @@ void MuSamAudioProcessorEditor::mouseDown(const juce::MouseEvent& e)
 
 void MuSamAudioProcessorEditor::parameterChanged(const juce::String& parameterID, float newValue)
 {
-    // TEST: Log all parameter changes to verify UI interactions work
-    juce::String logMsg = "MuSam: Parameter changed - " + parameterID + " = " + juce::String(newValue);
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
-    
-    // Also log to console for immediate feedback
-    std::cout << "MuSam: Parameter changed - " << parameterID.toStdString() << " = " << newValue << std::endl;
+    // TEST: Log all parameter changes to verify UI interactions work.
+    // Host automation calls this on the audio thread, so record a numeric event only.
+    pfs::Trace::instant(parameterID == "speed" ? "MuSam.speed" : "MuSam.volume", newValue);
 }
 
 void MuSamAudioProcessorEditor::resized()
@@ -576,8 +557,7 @@ void MuSamAudioProcessorEditor::resized()
     
     // Debug: Log resize event
     juce::String logMsg = "MuSam: Editor resized, bounds: " + getBounds().toString();
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
 }
 
 //==============================================================================
@@ -623,39 +603,6 @@ std::optional<juce::WebBrowserComponent::Resource> MuSamAudioProcessorEditor::ge
     return std::nullopt;
 }
 
-//==============================================================================
-// Debug Helper
-//==============================================================================
-
-void MuSamAudioProcessorEditor::writeDebugLog(const juce::String& message)
-{
-    // Write to file in user's home directory for easy access
-    juce::File logFile = juce::File::getSpecialLocation(juce::File::userHomeDirectory)
-                            .getChildFile("MuSam_debug.log");
-    
-    // TEST: Verify file is writable
-    if (!logFile.getParentDirectory().exists())
-    {
-        juce::Logger::writeToLog("MuSam ERROR: Log directory does not exist: " + 
-                                logFile.getParentDirectory().getFullPathName());
-        return;
-    }
-    
-    juce::String timestamp = juce::Time::getCurrentTime().toString(true, true);
-    juce::String logLine = timestamp + " - " + message + "\n";
-    
-    // Try to write to file (appendText returns bool, not Result)
-    bool success = logFile.appendText(logLine);
-    if (!success)
-    {
-        juce::Logger::writeToLog("MuSam ERROR: Failed to write to log file");
-        juce::Logger::writeToLog("MuSam ERROR: Log file path: " + logFile.getFullPathName());
-    }
-    
-    // Also write to JUCE logger (visible in Console.app on macOS)
-    juce::Logger::writeToLog("MuSam: " + message);
-}
-
 //==============================================================================
 // File Drag & Drop Implementation
 //==============================================================================
@@ -664,8 +611,7 @@ bool MuSamAudioProcessorEditor::isInterestedInFileDrag(const juce::StringArray&
 {
     // Debug: Write to both log and file
     juce::String logMsg = "MuSam: isInterestedInFileDrag called with " + juce::String(files.size()) + " file(s)";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     // Accept audio files (WAV, AIFF, MP3, etc.)
     // Case-insensitive check for all common audio formats
@@ -675,23 +621,20 @@ bool MuSamAudioProcessorEditor::isInterestedInFileDrag(const juce::StringArray&
         juce::String extension = f.getFileExtension().toLowerCase();
         
         logMsg = "MuSam: Checking file: " + f.getFullPathName() + " (extension: " + extension + ")";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
         
         if (extension == ".wav" || extension == ".aiff" || extension == ".aif" ||
             extension == ".mp3" || extension == ".m4a" || extension == ".aac" ||
             extension == ".flac" || extension == ".ogg" || extension == ".wma")
         {
             logMsg = "MuSam: File accepted for drag & drop";
-            juce::Logger::writeToLog(logMsg);
-            writeDebugLog(logMsg);
+            pfs::Trace::message("MuSam", logMsg);
             return true;
         }
     }
     
     logMsg = "MuSam: No supported files found in drag";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     return false;
 }
 
@@ -699,8 +642,7 @@ void MuSamAudioProcessorEditor::fileDragEnter(const juce::StringArray& files, in
 {
     juce::String logMsg = "MuSam: fileDragEnter - " + juce::String(files.size()) + " file(s) at (" + 
                          juce::String(x) + ", " + juce::String(y) + ")";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     // Notify WebView that drag has entered
     if (webView != nullptr)
@@ -709,14 +651,12 @@ void MuSamAudioProcessorEditor::fileDragEnter(const juce::StringArray& files, in
             "if (window.handleDragEnter) { window.handleDragEnter(); }"
         );
         logMsg = "MuSam: Sent dragEnter notification to WebView";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
     }
     else
     {
         logMsg = "MuSam: ERROR - WebView is null!";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
     }
     juce::ignoreUnused(files, x, y);
 }
@@ -729,7 +669,7 @@ void MuSamAudioProcessorEditor::fileDragMove(const juce::StringArray& files, int
 
 void MuSamAudioProcessorEditor::fileDragExit(const juce::StringArray& files)
 {
-    juce::Logger::writeToLog("MuSam: fileDragExit");
+    pfs::Trace::message("MuSam", "MuSam: fileDragExit");
     
     // Notify WebView that drag has exited
     if (webView != nullptr)
@@ -745,14 +685,12 @@ void MuSamAudioProcessorEditor::filesDropped(const juce::StringArray& files, int
 {
     juce::String logMsg = "MuSam: filesDropped - " + juce::String(files.size()) + " file(s) at (" + 
                          juce::String(x) + ", " + juce::String(y) + ")";
-    juce::Logger::writeToLog(logMsg);
-    writeDebugLog(logMsg);
+    pfs::Trace::message("MuSam", logMsg);
     
     if (files.isEmpty())
     {
         logMsg = "MuSam: ERROR - filesDropped called with empty file list!";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
         return;
     }
     
@@ -765,8 +703,7 @@ void MuSamAudioProcessorEditor::filesDropped(const juce::StringArray& files, int
         
         logMsg = "MuSam: Processing dropped file: " + f.getFullPathName() + 
                  " (extension: " + extension + ")";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
         
         // Case-insensitive check for all supported formats
         if (extension == ".wav" || extension == ".aiff" || extension == ".aif" ||
@@ -775,15 +712,13 @@ void MuSamAudioProcessorEditor::filesDropped(const juce::StringArray& files, int
         {
             // Debug: Log file being loaded
             logMsg = "MuSam: Accepted file format, loading: " + f.getFullPathName();
-            juce::Logger::writeToLog(logMsg);
-            writeDebugLog(logMsg);
+            pfs::Trace::message("MuSam", logMsg);
             
             // Check if file exists
             if (!f.existsAsFile())
             {
                 logMsg = "MuSam: ERROR - File does not exist: " + f.getFullPathName();
-                juce::Logger::writeToLog(logMsg);
-                writeDebugLog(logMsg);
+                pfs::Trace::message("MuSam", logMsg);
                 continue;
             }
             
@@ -799,14 +734,12 @@ void MuSamAudioProcessorEditor::filesDropped(const juce::StringArray& files, int
                     "if (window.handleFileLoaded) { window.handleFileLoaded('" + filename + "'); }"
                 );
                 logMsg = "MuSam: Sent fileLoaded notification to WebView";
-                juce::Logger::writeToLog(logMsg);
-                writeDebugLog(logMsg);
+                pfs::Trace::message("MuSam", logMsg);
             }
             else
             {
                 logMsg = "MuSam: ERROR - WebView is null when trying to notify!";
-                juce::Logger::writeToLog(logMsg);
-                writeDebugLog(logMsg);
+                pfs::Trace::message("MuSam", logMsg);
             }
             
             break; // Only load first valid file
@@ -816,16 +749,14 @@ void MuSamAudioProcessorEditor::filesDropped(const juce::StringArray& files, int
             // Debug: Log unsupported file
             logMsg = "MuSam: Unsupported file type: " + f.getFullPathName() + 
                     " (extension: " + extension + ")";
-            juce::Logger::writeToLog(logMsg);
-            writeDebugLog(logMsg);
+            pfs::Trace::message("MuSam", logMsg);
         }
     }
     
     if (!fileLoaded)
     {
         logMsg = "MuSam: WARNING - No valid audio file was loaded from dropped files";
-        juce::Logger::writeToLog(logMsg);
-        writeDebugLog(logMsg);
+        pfs::Trace::message("MuSam", logMsg);
     }
     
     juce::ignoreUnused(x, y);
@@ -94,12 +94,6 @@ private:
         const juce::String& url
     );
 
-    /**
-     * Debug helper: Write log message to file
-     * @param message Log message to write
-     */
-    void writeDebugLog(const juce::String& message);
-
     // Reference to audio processor
     MuSamAudioProcessor& processorRef;
 
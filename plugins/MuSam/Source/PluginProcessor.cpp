@@ -229,6 +229,11 @@ MuSamAudioProcessor::MuSamAudioProcessor()
 {
     // Register audio formats (WAV, AIFF, MP3 via system codecs)
     formatManager.registerBasicFormats();
+
+    // Fresh instances get their own Random-mode step sequence; the seed is
+    // stored with the state (see setStateInformation)
+    stepSeed = juce::Random().nextInt64();
+    parameters.state.setProperty("stepSeed", stepSeed.load(), nullptr);
 }
 
 MuSamAudioProcessor::~MuSamAudioProcessor()
@@ -245,6 +250,9 @@ void MuSamAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
     updateRegionBoundaries();
+
+    // Same Random-mode step sequence for every render started from here
+    stepRandom.setSeed(static_cast<uint64_t>(stepSeed.load()));
     
     // Phase 4.2: Prepare DSP processors
     juce::dsp::ProcessSpec spec;
@@ -302,6 +310,7 @@ void MuSamAudioProcessor::releaseResources()
 void MuSamAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    pfs::TraceScope blockTrace("MuSam::processBlock", buffer.getNumSamples());
     
     // Clear output buffer
     buffer.clear();
@@ -466,6 +475,12 @@ void MuSamAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
         suspendProcessing(true);
         
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+        // Sessions saved before the seed existed keep this instance's fresh seed
+        if (parameters.state.hasProperty("stepSeed"))
+            stepSeed = static_cast<juce::int64>(parameters.state.getProperty("stepSeed"));
+        else
+            parameters.state.setProperty("stepSeed", stepSeed.load(), nullptr);
         
         // Resume audio processing after state is loaded
         suspendProcessing(false);
@@ -827,7 +842,7 @@ void MuSamAudioProcessor::advanceSequencerStep()
     }
     else if (playbackMode == 1)  // Random
     {
-        nextStep = juce::Random::getSystemRandom().nextInt(8);
+        nextStep = stepRandom.nextInt(8);
     }
     else  // Custom (same as Sequential for now)
     {
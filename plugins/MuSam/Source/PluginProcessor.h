@@ -3,6 +3,8 @@
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_formats/juce_audio_formats.h>
 #include <atomic>
+#include "NoiseSource.h"
+#include "Trace.h"
 
 class MuSamAudioProcessor : public juce::AudioProcessor
 {
@@ -97,6 +99,8 @@ private:
         float crossfadePosition = 0.0f; // Crossfade position (0.0 to 1.0)
     };
     SequencerState sequencerState;
+    pfs::NoiseSource stepRandom;  // Random playback mode (audio thread only), re-seeded from stepSeed in prepareToPlay
+    std::atomic<juce::int64> stepSeed { 0 };  // Per-instance, saved with the state for reproducible renders
 
     // Playback state
     double currentSampleRate = 44100.0;
@@ -123,6 +127,9 @@ private:
     void advanceSequencerStep();
     void applyCrossfade(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, int outgoingRegion, int incomingRegion);
 
+    // Diagnostics: shared trace writer thread (log/profile output, see pfs::Trace)
+    juce::SharedResourcePointer<pfs::TraceWriter> traceWriter;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MuSamAudioProcessor)
 };
 
@@ -120,7 +120,7 @@ void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
     for (int sample = 0; sample < numSamples; ++sample)
     {
         // 1. Generate white noise: range [-1.0, 1.0]
-        float noiseSample = (noiseGenerator.nextFloat() * 2.0f) - 1.0f;
+        float noiseSample = noiseGenerator.nextBipolar();
 
         // 2. Apply Tone Filter (brightness control)
         // Exponential frequency mapping: 3kHz-15kHz
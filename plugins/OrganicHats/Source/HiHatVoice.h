@@ -2,6 +2,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "HiHatSound.h"
+#include "NoiseSource.h"
 
 class HiHatVoice : public juce::SynthesiserVoice
 {
@@ -23,11 +24,14 @@ public:
 
     void prepareToPlay(double sampleRate, int samplesPerBlock);
 
+    // Deterministic per-voice noise stream (decorrelated between voices)
+    void seedNoise(uint64_t seed) { noiseGenerator.setSeed(seed); }
+
 private:
     juce::AudioProcessorValueTreeState& parameters;
 
     // Noise generation
-    juce::Random noiseGenerator;
+    pfs::NoiseSource noiseGenerator;
 
     // Envelope shaping
     juce::ADSR envelope;
@@ -86,8 +86,13 @@ void OrganicHatsAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     for (int i = 0; i < synth.getNumVoices(); ++i)
     {
         if (auto* voice = dynamic_cast<HiHatVoice*>(synth.getVoice(i)))
+        {
             voice->prepareToPlay(sampleRate, samplesPerBlock);
+            voice->seedNoise(pfs::NoiseSource::streamSeed(0x0a6a41c5, i));
+        }
     }
+
+    silence.prepare(sampleRate, 0.05);
 }
 
 void OrganicHatsAudioProcessor::releaseResources()
@@ -99,6 +104,14 @@ void OrganicHatsAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 {
     juce::ScopedNoDenormals noDenormals;
 
+    // Idle instance: every voice has cleared its note and no MIDI at all
+    // (the Synthesiser tracks pedal/pitch-wheel state, so it sees every message)
+    if (midiMessages.isEmpty() && silence.isIdle(anyVoiceActive(), midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        return;
+    }
+
     // Clear output buffer before synthesiser adds to it
     buffer.clear();
 
@@ -129,6 +142,19 @@ void OrganicHatsAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
     // Render MIDI-triggered hi-hat voices
     synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+
+    silence.trackTail(buffer, anyVoiceActive());
+}
+
+bool OrganicHatsAudioProcessor::anyVoiceActive() const
+{
+    for (int i = 0; i < synth.getNumVoices(); ++i)
+    {
+        if (synth.getVoice(i)->isVoiceActive())
+            return true;
+    }
+
+    return false;
 }
 
 juce::AudioProcessorEditor* OrganicHatsAudioProcessor::createEditor()
@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "SilenceTracker.h"
 
 class OrganicHatsAudioProcessor : public juce::AudioProcessor
 {
@@ -37,5 +38,9 @@ private:
     // Synthesiser for hi-hat voice management
     juce::Synthesiser synth;
 
+    // Idle-instance fast path (no active voice, no note-on → skip the block)
+    pfs::SilenceTracker silence;
+    bool anyVoiceActive() const;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OrganicHatsAudioProcessor)
 };
@@ -0,0 +1,200 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+
+// Circular capture buffer for the grain engine.
+//
+// Capacity is a power of two so every read/write wraps with a single mask
+// instead of DelayLine's per-call modulo and read-pointer bookkeeping. The
+// buffer is written a block at a time; grains read whole spans from it with
+// their own read head (absolute buffer position, not a delay), so a grain
+// costs one call per block instead of one popSample() per sample.
+class GrainCaptureBuffer
+{
+public:
+    enum class Interpolation { Linear, Cubic, Sinc };
+
+    // Allocates (message thread / prepareToPlay only)
+    void prepare(int numChannels, int minimumCapacity)
+    {
+        capacity = juce::nextPowerOfTwo(juce::jmax(minimumCapacity, 64));
+        mask = capacity - 1;
+        buffer.setSize(numChannels, capacity);
+        reset();
+
+        getSincTable();  // Build the shared kernel table here, not on the first sinc read
+    }
+
+    void reset()
+    {
+        buffer.clear();
+        writeIndex = 0;
+    }
+
+    int getCapacity() const { return capacity; }
+    int getNumChannels() const { return buffer.getNumChannels(); }
+
+    // Position the next write() lands on; grain read heads are expressed in the same units
+    int getWritePosition() const { return writeIndex; }
+
+    // Wrap any head position into [0, capacity)
+    double wrap(double position) const
+    {
+        const double size = static_cast<double>(capacity);
+        position = std::fmod(position, size);
+        return position < 0.0 ? position + size : position;
+    }
+
+    // Copy numSamples into `channel` at the write position (call for every channel, then advance())
+    void write(int channel, const float* source, int numSamples)
+    {
+        auto* dest = buffer.getWritePointer(channel);
+        const int first = juce::jmin(numSamples, capacity - writeIndex);
+
+        juce::FloatVectorOperations::copy(dest + writeIndex, source, first);
+        juce::FloatVectorOperations::copy(dest, source + first, numSamples - first);
+    }
+
+    // Mid/side capture: channel 0 = (L + R) / 2, channel 1 = (L - R) / 2
+    void writeMidSide(const float* left, const float* right, int numSamples)
+    {
+        auto* mid = buffer.getWritePointer(0);
+        auto* side = buffer.getWritePointer(1);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const int index = (writeIndex + i) & mask;
+            mid[index] = 0.5f * (left[i] + right[i]);
+            side[index] = 0.5f * (left[i] - right[i]);
+        }
+    }
+
+    void advance(int numSamples)
+    {
+        writeIndex = (writeIndex + numSamples) & mask;
+    }
+
+    // dest[i] = sample at (start + i * increment), i in [0, numSamples).
+    // Negative increments read backwards (reverse grains).
+    void read(Interpolation interpolation, int channel, double start, float increment,
+              float* dest, int numSamples) const
+    {
+        switch (interpolation)
+        {
+            case Interpolation::Linear: readSpan<Interpolation::Linear>(channel, start, increment, dest, numSamples); break;
+            case Interpolation::Sinc:   readSpan<Interpolation::Sinc>  (channel, start, increment, dest, numSamples); break;
+            case Interpolation::Cubic:
+            default:                    readSpan<Interpolation::Cubic> (channel, start, increment, dest, numSamples); break;
+        }
+    }
+
+    // Samples a read head must stay behind the write position for the widest kernel
+    static constexpr int guardSamples = 8;
+
+private:
+    template <Interpolation Mode>
+    void readSpan(int channel, double start, float increment, float* dest, int numSamples) const
+    {
+        const float* data = buffer.getReadPointer(channel);
+
+        // Split the head into an integer base plus a small float offset so the
+        // per-sample position math stays in float and the loop vectorises
+        const double base = std::floor(start);
+        const int baseIndex = static_cast<int>(base);
+        const float baseFraction = static_cast<float>(start - base);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float offset = baseFraction + static_cast<float>(i) * increment;
+            const float whole = std::floor(offset);
+            const int index = baseIndex + static_cast<int>(whole);
+            const float frac = offset - whole;
+
+            if constexpr (Mode == Interpolation::Linear)
+            {
+                const float y0 = data[index & mask];
+                const float y1 = data[(index + 1) & mask];
+                dest[i] = y0 + frac * (y1 - y0);
+            }
+            else if constexpr (Mode == Interpolation::Cubic)
+            {
+                // 4-point Catmull-Rom
+                const float ym1 = data[(index - 1) & mask];
+                const float y0  = data[index & mask];
+                const float y1  = data[(index + 1) & mask];
+                const float y2  = data[(index + 2) & mask];
+
+                const float c1 = 0.5f * (y1 - ym1);
+                const float c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+                const float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+                dest[i] = ((c3 * frac + c2) * frac + c1) * frac + y0;
+            }
+            else
+            {
+                // 8-tap windowed sinc, taps at index-3 .. index+4
+                const auto& table = getSincTable();
+                const float phase = frac * static_cast<float>(sincPhases);
+                const int phaseIndex = juce::jmin(sincPhases - 1, static_cast<int>(phase));
+                const float phaseFrac = phase - static_cast<float>(phaseIndex);
+                const auto& k0 = table[static_cast<size_t>(phaseIndex)];
+                const auto& k1 = table[static_cast<size_t>(phaseIndex + 1)];
+
+                float sum = 0.0f;
+
+                for (int tap = 0; tap < sincTaps; ++tap)
+                {
+                    const float weight = k0[static_cast<size_t>(tap)] + phaseFrac * (k1[static_cast<size_t>(tap)] - k0[static_cast<size_t>(tap)]);
+                    sum += weight * data[(index - sincTaps / 2 + 1 + tap) & mask];
+                }
+
+                dest[i] = sum;
+            }
+        }
+    }
+
+    static constexpr int sincTaps = 8;
+    static constexpr int sincPhases = 256;
+    using SincTable = std::array<std::array<float, sincTaps>, sincPhases + 1>;
+
+    // Blackman-windowed sinc kernels for fractional offsets 0 .. 1, built once
+    static const SincTable& getSincTable()
+    {
+        static const SincTable table = []
+        {
+            SincTable t {};
+            const double halfWidth = sincTaps / 2;
+
+            for (int p = 0; p <= sincPhases; ++p)
+            {
+                const double frac = static_cast<double>(p) / sincPhases;
+                double sum = 0.0;
+
+                for (int tap = 0; tap < sincTaps; ++tap)
+                {
+                    const double x = static_cast<double>(tap - sincTaps / 2 + 1) - frac;
+                    const double sinc = std::abs(x) < 1.0e-9 ? 1.0
+                                                             : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+                    const double w = (x + halfWidth) / (2.0 * halfWidth);
+                    const double window = 0.42 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * w)
+                                        + 0.08 * std::cos(2.0 * juce::MathConstants<double>::twoPi * w);
+                    t[static_cast<size_t>(p)][static_cast<size_t>(tap)] = static_cast<float>(sinc * window);
+                    sum += sinc * window;
+                }
+
+                // Unity DC gain at every phase
+                for (auto& weight : t[static_cast<size_t>(p)])
+                    weight = static_cast<float>(weight / sum);
+            }
+
+            return t;
+        }();
+
+        return table;
+    }
+
+    juce::AudioBuffer<float> buffer;
+    int capacity = 0;
+    int mask = 0;
+    int writeIndex = 0;
+};
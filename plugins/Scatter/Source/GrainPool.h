@@ -0,0 +1,97 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <vector>
+
+// Structure-of-arrays grain state with an O(1) free-list allocator.
+//
+// Storage is sized once in prepareToPlay (allocate()) from the user's maximum
+// grain count; spawn/retire never allocate. Active grains are kept in a dense
+// index list so the render loop walks only live grains - cost scales with the
+// cloud, not with the pool size.
+struct GrainPool
+{
+    // Per-grain state, indexed by slot
+    std::vector<double> readPosition;    // Read head in the capture buffer (fractional samples)
+    std::vector<float> increment;        // Read head step per sample (negative = reverse)
+    std::vector<float> windowPosition;   // Position in window envelope (0.0-1.0)
+    std::vector<float> windowIncrement;  // 1 / grain size
+    std::vector<float> leftFromCh0;      // Output matrix: capture channels → L/R (pan, width, swap)
+    std::vector<float> leftFromCh1;
+    std::vector<float> rightFromCh0;
+    std::vector<float> rightFromCh1;
+    std::vector<float> playbackRate;     // Pitch (visualization)
+    std::vector<float> pan;              // 0.0 = left, 1.0 = right (visualization)
+    std::vector<int> grainSizeSamples;
+    std::vector<int> samplesRemaining;   // Samples left until the grain retires
+    std::vector<int> startOffset;        // Onset sample within the chunk it was spawned in
+
+    // Message thread (prepareToPlay) only
+    void allocate(int newCapacity)
+    {
+        capacity = juce::jmax(1, newCapacity);
+        const auto size = static_cast<size_t>(capacity);
+
+        for (auto* v : { &increment, &windowPosition, &windowIncrement, &leftFromCh0, &leftFromCh1, &rightFromCh0, &rightFromCh1, &playbackRate, &pan })
+            v->assign(size, 0.0f);
+
+        for (auto* v : { &grainSizeSamples, &samplesRemaining, &startOffset })
+            v->assign(size, 0);
+
+        readPosition.assign(size, 0.0);
+        activeSlots.assign(size, 0);
+        freeSlots.assign(size, 0);
+        clear();
+    }
+
+    void clear()
+    {
+        numActive = 0;
+        numFree = capacity;
+
+        for (int i = 0; i < capacity; ++i)
+            freeSlots[static_cast<size_t>(i)] = capacity - 1 - i;
+    }
+
+    int getCapacity() const { return capacity; }
+    int getNumActive() const { return numActive; }
+
+    // Slot of the n-th active grain, n in [0, getNumActive())
+    int getActiveSlot(int n) const { return activeSlots[static_cast<size_t>(n)]; }
+
+    // Claim a slot for a new grain. When every slot is busy (or maxActive grains
+    // are already playing) the grain closest to finishing is stolen instead of
+    // dropping the new one.
+    int spawn(int maxActive)
+    {
+        if (numFree > 0 && numActive < maxActive)
+        {
+            const int slot = freeSlots[static_cast<size_t>(--numFree)];
+            activeSlots[static_cast<size_t>(numActive++)] = slot;
+            return slot;
+        }
+
+        jassert(numActive > 0);
+        int victim = 0;
+
+        for (int n = 1; n < numActive; ++n)
+            if (samplesRemaining[static_cast<size_t>(activeSlots[static_cast<size_t>(n)])]
+                < samplesRemaining[static_cast<size_t>(activeSlots[static_cast<size_t>(victim)])])
+                victim = n;
+
+        return activeSlots[static_cast<size_t>(victim)];
+    }
+
+    // Release the n-th active grain (swap-remove; the last active grain moves into n)
+    void retire(int n)
+    {
+        freeSlots[static_cast<size_t>(numFree++)] = activeSlots[static_cast<size_t>(n)];
+        activeSlots[static_cast<size_t>(n)] = activeSlots[static_cast<size_t>(--numActive)];
+    }
+
+private:
+    std::vector<int> activeSlots;
+    std::vector<int> freeSlots;
+    int capacity = 0;
+    int numActive = 0;
+    int numFree = 0;
+};
@@ -76,6 +76,59 @@ juce::AudioProcessorValueTreeState::ParameterLayout ScatterAudioProcessor::creat
         "%"
     ));
 
+    // width_random - Float (0.0 to 100.0 %, default: 0.0)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "width_random", 1 },
+        "Width Random",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        "%"
+    ));
+
+    // swap_random - Float (0.0 to 100.0 %, default: 0.0)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "swap_random", 1 },
+        "Swap Random",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
+        0.0f,
+        "%"
+    ));
+
+    // capture_mode - Choice (Stereo = L/R grains, Mid/Side = pan places the mid, side stays wide)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "capture_mode", 1 },
+        "Capture Mode",
+        juce::StringArray { "Stereo", "Mid/Side" },
+        0
+    ));
+
+    // interpolation - Choice (grain read quality: Linear, Cubic, Sinc)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "interpolation", 1 },
+        "Interpolation",
+        juce::StringArray { "Linear", "Cubic", "Sinc" },
+        1
+    ));
+
+    // window_shape - Choice (grain envelope)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "window_shape", 1 },
+        "Window Shape",
+        juce::StringArray { "Hann", "Tukey", "Blackman", "Gaussian", "Trapezoid" },
+        0
+    ));
+
+    // max_grains - Choice (grain pool size; memory is reserved in prepareToPlay).
+    // Lowering it caps the cloud immediately; raising it above the allocated
+    // pool only takes effect when the host next calls prepareToPlay
+    // (transport restart / re-enable), since the audio thread never allocates.
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "max_grains", 1 },
+        "Max Grains",
+        juce::StringArray { "64", "256", "1024" },
+        1
+    ));
+
     // mix - Float (0.0 to 100.0 %, default: 50.0)
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID { "mix", 1 },
@@ -96,6 +149,14 @@ ScatterAudioProcessor::ScatterAudioProcessor()
 {
     // Phase 3.2: Initialize scale lookup tables
     initializeScaleTables();
+
+    // Build the shared window bank now rather than on the first audio callback
+    pfs::WindowTables::get();
+
+    // Fresh instances get their own grain seed so stacked Scatter instances
+    // don't scatter identically; the seed is stored with the state (see setStateInformation)
+    noiseSeed = juce::Random().nextInt64();
+    parameters.state.setProperty("noiseSeed", noiseSeed.load(), nullptr);
 }
 
 ScatterAudioProcessor::~ScatterAudioProcessor()
@@ -104,43 +165,45 @@ ScatterAudioProcessor::~ScatterAudioProcessor()
 
 void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    juce::ignoreUnused(samplesPerBlock);
+
     // Store sample rate for grain size calculations
     currentSampleRate = sampleRate;
 
-    // Prepare DSP spec
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
+    // Same grain sequence for every render started from here
+    random.setSeed(static_cast<uint64_t>(noiseSeed.load()));
 
-    // Prepare delay buffer (size for maximum delay time: 2000ms)
-    auto maxDelayTimeSamples = static_cast<int>(sampleRate * 2.0);  // 2 seconds max
-    currentDelayBufferSize = maxDelayTimeSamples;
-    delayBuffer.setMaximumDelayInSamples(maxDelayTimeSamples);
-    delayBuffer.prepare(spec);
-    delayBuffer.reset();
+    // Prepare capture buffer: 2000ms max delay plus the furthest a 500ms grain
+    // can travel at 2x playback (reverse), plus the read-head lag. Independent
+    // of the host block size: blocks are rendered in processChunkSize pieces.
+    auto maxReachSamples = static_cast<int>(sampleRate * 3.5) + processChunkSize + GrainCaptureBuffer::guardSamples;
+    captureBuffer.prepare(2, maxReachSamples);
+    currentDelayBufferSize = captureBuffer.getCapacity();
+    blockStartPosition = 0;
 
-    // Phase 3.3: Prepare dry/wet mixer
-    dryWetMixer.prepare(spec);
-    dryWetMixer.reset();
+    // Phase 3.3: Dry/wet mix ramp (replaces DryWetMixer, which needs a maximum block size)
+    mixSmoothed.reset(sampleRate, 0.05);
+    mixSmoothed.setCurrentAndTargetValue(parameters.getRawParameterValue("mix")->load() / 100.0f);
 
-    // Phase 3.3: Allocate feedback buffer (stereo)
-    feedbackBuffer.setSize(2, samplesPerBlock);
-    feedbackBuffer.clear();
+    // Initialize grain scheduler (first grain at the first sample)
+    samplesUntilNextGrain = 0.0;
 
-    // Initialize grain scheduler
-    grainSpawnCounter = 0;
-    lastGrainSpawnInterval = 0;
-
-    // Clear all grain voices
-    for (auto& grain : grainVoices)
+    // Allocate the grain pool for the selected maximum (all grains inactive).
+    // Raising max_grains above this takes effect on the next prepareToPlay.
+    // The editor never reads the pool (see publishGrainSnapshot), so this is
+    // safe while it is open.
     {
-        grain.active = false;
-        grain.readPosition = 0.0f;
-        grain.windowPosition = 0.0f;
-        grain.grainSizeSamples = 0;
-        grain.pan = 0.5f;
-        grain.reverse = false;
+        const juce::SpinLock::ScopedLockType lock(grainSnapshotLock);
+        grainSnapshotSize = 0;
     }
+
+    grains.allocate(getMaxGrains(static_cast<int>(parameters.getRawParameterValue("max_grains")->load())));
+}
+
+int ScatterAudioProcessor::getMaxGrains(int choiceIndex)
+{
+    static constexpr int sizes[] = { 64, 256, 1024 };
+    return sizes[juce::jlimit(0, 2, choiceIndex)];
 }
 
 void ScatterAudioProcessor::releaseResources()
@@ -167,68 +230,109 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     auto* feedbackParam = parameters.getRawParameterValue("feedback");
     auto* mixParam = parameters.getRawParameterValue("mix");
 
-    float delayTimeMs = delayTimeParam->load();
-    float grainSizeMs = grainSizeParam->load();
-    float densityPercent = densityParam->load();
-    float pitchRandomPercent = pitchRandomParam->load();
-    int scaleIndex = static_cast<int>(scaleParam->load());
-    int rootNote = static_cast<int>(rootNoteParam->load());
-    float panRandomPercent = panRandomParam->load();
+    GrainSpawnSettings settings;
+    settings.delayTimeMs = delayTimeParam->load();
+    settings.grainSizeMs = grainSizeParam->load();
+    settings.densityPercent = densityParam->load();
+    settings.pitchRandomPercent = pitchRandomParam->load();
+    settings.scaleIndex = static_cast<int>(scaleParam->load());
+    settings.rootNote = static_cast<int>(rootNoteParam->load());
+    settings.panRandomPercent = panRandomParam->load();
+    settings.widthRandomPercent = parameters.getRawParameterValue("width_random")->load();
+    settings.swapRandomPercent = parameters.getRawParameterValue("swap_random")->load();
+    settings.midSide = parameters.getRawParameterValue("capture_mode")->load() >= 0.5f;
+    settings.maxGrains = getMaxGrains(static_cast<int>(parameters.getRawParameterValue("max_grains")->load()));
     float feedbackGain = feedbackParam->load() / 100.0f * 0.95f;  // Map 0-100% to 0.0-0.95
     float mixValue = mixParam->load() / 100.0f;  // Map 0-100% to 0.0-1.0
+    auto interpolation = static_cast<GrainCaptureBuffer::Interpolation>(
+        static_cast<int>(parameters.getRawParameterValue("interpolation")->load()));
+    auto windowShape = static_cast<pfs::WindowShape>(
+        static_cast<int>(parameters.getRawParameterValue("window_shape")->load()));
 
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
-    // Phase 3.3: Step 1 - Capture dry signal
-    juce::dsp::AudioBlock<float> block(buffer);
-    dryWetMixer.pushDrySamples(block);
+    if (numChannels == 0)
+        return;
+
+    mixSmoothed.setTargetValue(mixValue);
 
-    // Phase 3.3: Step 2 - Mix feedback signal with input
-    for (int channel = 0; channel < numChannels; ++channel)
+    auto* leftData = buffer.getWritePointer(0);
+    auto* rightData = numChannels > 1 ? buffer.getWritePointer(1) : nullptr;
+
+    // Render on a fixed grid of processChunkSize samples aligned to the capture
+    // position, not to the host block, so any block size (including blocks larger
+    // than announced in prepareToPlay) produces the same output sample for sample
+    for (int start = 0; start < numSamples;)
     {
-        auto* channelData = buffer.getWritePointer(channel);
-        auto* feedbackData = feedbackBuffer.getReadPointer(channel);
+        const int gridPhase = captureBuffer.getWritePosition() & (processChunkSize - 1);
+        const int count = juce::jmin(numSamples - start, processChunkSize - gridPhase);
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            channelData[sample] += feedbackData[sample];
-        }
+        processChunk(leftData + start, rightData != nullptr ? rightData + start : nullptr,
+                     count, settings, feedbackGain, interpolation, windowShape);
+        start += count;
     }
 
-    // Phase 3.3: Step 3 - Write input + feedback to delay buffer (stereo)
-    for (int channel = 0; channel < juce::jmin(2, numChannels); ++channel)
+    publishGrainSnapshot();
+}
+
+void ScatterAudioProcessor::processChunk(float* left, float* right, int numSamples, const GrainSpawnSettings& settings,
+                                         float feedbackGain, GrainCaptureBuffer::Interpolation interpolation,
+                                         pfs::WindowShape windowShape)
+{
+    jassert(numSamples <= processChunkSize);
+
+    // Phase 3.3: Step 1 - Spawn the grains whose onsets fall inside this chunk
+    blockStartPosition = captureBuffer.getWritePosition();
+    updateGrainScheduler(numSamples, settings);
+
+    // Phase 3.3: Step 2 - Render grains. Read heads stay more than a chunk behind
+    // the write position, so they only see capture written before this chunk.
+    float* wetLeft = wetScratch.data();
+    float* wetRight = wetScratch.data() + processChunkSize;
+    processGrainVoices(wetLeft, wetRight, numSamples, interpolation, windowShape);
+
+    // Mono output: fold the grain's two output gains into the single channel
+    if (right == nullptr)
     {
-        auto* channelData = buffer.getReadPointer(channel);
+        juce::FloatVectorOperations::add(wetLeft, wetRight, numSamples);
+        juce::FloatVectorOperations::copy(wetRight, wetLeft, numSamples);
+    }
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            delayBuffer.pushSample(channel, channelData[sample]);
-        }
+    // Phase 3.3: Step 3 - Input + feedback into the capture buffer. The wet sample
+    // is recirculated at the same capture position as the input sample, so the
+    // feedback delay is the grain delay alone, whatever the host block size.
+    const float* inputRight = right != nullptr ? right : left;  // Mono input feeds both capture channels
+    float* captureLeft = captureScratch.data();
+    float* captureRight = captureScratch.data() + processChunkSize;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        captureLeft[i] = left[i] + wetLeft[i] * feedbackGain;
+        captureRight[i] = inputRight[i] + wetRight[i] * feedbackGain;
     }
 
-    // Phase 3.3: Step 4 - Update grain scheduler and spawn grains
-    updateGrainScheduler(densityPercent, grainSizeMs, pitchRandomPercent, panRandomPercent, scaleIndex, rootNote);
+    if (settings.midSide)
+    {
+        captureBuffer.writeMidSide(captureLeft, captureRight, numSamples);
+    }
+    else
+    {
+        captureBuffer.write(0, captureLeft, numSamples);
+        captureBuffer.write(1, captureRight, numSamples);
+    }
 
-    // Phase 3.3: Step 5 - Process active grain voices (stereo output)
-    processGrainVoices(buffer);
+    captureBuffer.advance(numSamples);
 
-    // Phase 3.3: Step 6 - Apply feedback gain and store for next cycle
-    feedbackBuffer.clear();
-    for (int channel = 0; channel < numChannels; ++channel)
+    // Phase 3.3: Step 4 - Blend with the dry input (linear, ramped mix)
+    for (int i = 0; i < numSamples; ++i)
     {
-        auto* wetData = buffer.getReadPointer(channel);
-        auto* feedbackData = feedbackBuffer.getWritePointer(channel);
+        const float wetMix = mixSmoothed.getNextValue();
+        left[i] += wetMix * (wetLeft[i] - left[i]);
 
-        for (int sample = 0; sample < numSamples; ++sample)
-        {
-            feedbackData[sample] = wetData[sample] * feedbackGain;
-        }
+        if (right != nullptr)
+            right[i] += wetMix * (wetRight[i] - right[i]);
     }
-
-    // Phase 3.3: Step 7 - Blend with dry signal using dry/wet mixer
-    dryWetMixer.setWetMixProportion(mixValue);
-    dryWetMixer.mixWetSamples(block);
 }
 
 juce::AudioProcessorEditor* ScatterAudioProcessor::createEditor()
@@ -248,7 +352,15 @@ void ScatterAudioProcessor::setStateInformation(const void* data, int sizeInByte
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
+    {
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+
+        // Sessions saved before the seed existed keep this instance's fresh seed
+        if (parameters.state.hasProperty("noiseSeed"))
+            noiseSeed = static_cast<juce::int64>(parameters.state.getProperty("noiseSeed"));
+        else
+            parameters.state.setProperty("noiseSeed", noiseSeed.load(), nullptr);
+    }
 }
 
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -262,229 +374,204 @@ juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 
 std::vector<ScatterAudioProcessor::GrainVisualizationData> ScatterAudioProcessor::getActiveGrainPositions() const
 {
-    std::vector<GrainVisualizationData> data;
+    const juce::SpinLock::ScopedLockType lock(grainSnapshotLock);
+    return { grainSnapshot.begin(), grainSnapshot.begin() + grainSnapshotSize };
+}
 
-    // Copy active grain positions (thread-safe read - audio thread writes, message thread reads)
-    for (const auto& grain : grainVoices)
-    {
-        if (grain.active)
-        {
-            GrainVisualizationData vizData;
+void ScatterAudioProcessor::publishGrainSnapshot()
+{
+    // Audio thread: never wait for the editor, the next block publishes again
+    const juce::SpinLock::ScopedTryLockType lock(grainSnapshotLock);
 
-            // X-axis: Normalized time position in delay buffer (0.0-1.0)
-            vizData.x = grain.readPosition / static_cast<float>(currentDelayBufferSize);
+    if (! lock.isLocked())
+        return;
 
-            // Y-axis: Pitch shift normalized to -1.0 to +1.0 range
-            // playbackRate = 2^(semitones / 12)
-            // Reverse calculation: semitones = 12 * log2(playbackRate)
-            float semitones = 12.0f * std::log2(grain.playbackRate);
-            vizData.y = semitones / 7.0f;  // Normalize to -1.0 to +1.0 (-7 to +7 semitones)
+    grainSnapshotSize = juce::jmin(grains.getNumActive(), maxVisualizedGrains);
 
-            // Pan position (already 0.0-1.0)
-            vizData.pan = grain.pan;
+    for (int n = 0; n < grainSnapshotSize; ++n)
+    {
+        const auto slot = static_cast<size_t>(grains.getActiveSlot(n));
+        auto& vizData = grainSnapshot[static_cast<size_t>(n)];
 
-            data.push_back(vizData);
-        }
-    }
+        // X-axis: Normalized read position in the capture buffer (0.0-1.0)
+        vizData.x = static_cast<float>(grains.readPosition[slot]) / static_cast<float>(currentDelayBufferSize);
+
+        // Y-axis: Pitch shift normalized to -1.0 to +1.0 range
+        // playbackRate = 2^(semitones / 12)
+        // Reverse calculation: semitones = 12 * log2(playbackRate)
+        float semitones = 12.0f * std::log2(grains.playbackRate[slot]);
+        vizData.y = semitones / 7.0f;  // Normalize to -1.0 to +1.0 (-7 to +7 semitones)
 
-    return data;
+        // Pan position (already 0.0-1.0)
+        vizData.pan = grains.pan[slot];
+    }
 }
 
 // ============================================================================
 // Phase 3.1: Core Granular Engine Helper Methods
 // ============================================================================
 
-void ScatterAudioProcessor::generateHannWindow(int sizeInSamples)
-{
-    hannWindow.resize(sizeInSamples);
-    windowTableSize = sizeInSamples;
-
-    // Generate Hann window: hann[n] = 0.5 * (1 - cos(2 * pi * n / N))
-    juce::dsp::WindowingFunction<float>::fillWindowingTables(
-        hannWindow.data(),
-        sizeInSamples,
-        juce::dsp::WindowingFunction<float>::hann,
-        false  // Not normalized (we want 0-1 range)
-    );
-}
-
-void ScatterAudioProcessor::spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote)
+void ScatterAudioProcessor::spawnNewGrain(int startOffset, const GrainSpawnSettings& settings)
 {
     // Convert grain size from ms to samples
-    int grainSizeSamples = static_cast<int>(currentSampleRate * grainSizeMs / 1000.0f);
+    int grainSizeSamples = static_cast<int>(currentSampleRate * settings.grainSizeMs / 1000.0f);
 
     // Clamp to valid range (avoid zero or negative sizes)
     grainSizeSamples = juce::jmax(1, grainSizeSamples);
 
-    // Find inactive voice (voice allocation)
-    GrainVoice* availableVoice = nullptr;
-
-    for (auto& grain : grainVoices)
-    {
-        if (!grain.active)
-        {
-            availableVoice = &grain;
-            break;
-        }
-    }
-
-    // If no voices available, steal the first voice (simple voice stealing)
-    if (availableVoice == nullptr)
-    {
-        availableVoice = &grainVoices[0];
-    }
-
-    // Get random number generator
-    auto& random = juce::Random::getSystemRandom();
+    // Claim a grain slot (O(1); steals the grain closest to finishing when full)
+    const auto slot = static_cast<size_t>(grains.spawn(settings.maxGrains));
 
     // Phase 3.2: Generate random pitch and quantize to scale
-    float randomPitch = (random.nextFloat() * 2.0f - 1.0f) * 7.0f * (pitchRandomPercent / 100.0f);
-    int quantizedPitch = quantizePitchToScale(randomPitch, scaleIndex, rootNote);
+    float randomPitch = random.nextBipolar() * 7.0f * (settings.pitchRandomPercent / 100.0f);
+    int quantizedPitch = quantizePitchToScale(randomPitch, settings.scaleIndex, settings.rootNote);
     float playbackRate = std::pow(2.0f, quantizedPitch / 12.0f);
 
     // Phase 3.3: Generate random pan position (0.0 = left, 1.0 = right)
     float basePan = 0.5f;  // Center
-    float randomPan = random.nextFloat();  // 0.0-1.0
-    float panAmount = (randomPan - 0.5f) * (panRandomPercent / 100.0f);  // Scaled by parameter
+    float randomPan = random.nextUniform();  // 0.0-1.0
+    float panAmount = (randomPan - 0.5f) * (settings.panRandomPercent / 100.0f);  // Scaled by parameter
     float pan = juce::jlimit(0.0f, 1.0f, basePan + panAmount);
 
     // Phase 3.3: Random reverse playback (50/50 probability)
-    bool reverse = random.nextBool();
+    bool reverse = random.nextUniform() < 0.5f;
+
+    // Phase 3.3: Random stereo width (1 = as captured, 0 = mono) and L/R swap
+    float width = 1.0f - random.nextUniform() * (settings.widthRandomPercent / 100.0f);
+    bool swap = random.nextUniform() < settings.swapRandomPercent / 100.0f;
 
     // Initialize grain voice
-    availableVoice->active = true;
-    availableVoice->grainSizeSamples = grainSizeSamples;
-    availableVoice->windowPosition = 0.0f;
-    availableVoice->playbackRate = playbackRate;
-    availableVoice->pan = pan;
-    availableVoice->reverse = reverse;
-
-    // Read position: Start at current delay buffer write position
-    availableVoice->readPosition = 0.0f;
-
-    // Generate Hann window for this grain size (if not already cached)
-    if (windowTableSize != grainSizeSamples)
+    grains.grainSizeSamples[slot] = grainSizeSamples;
+    grains.samplesRemaining[slot] = grainSizeSamples;
+    grains.windowPosition[slot] = 0.0f;
+    grains.windowIncrement[slot] = 1.0f / static_cast<float>(grainSizeSamples);
+    grains.playbackRate[slot] = playbackRate;
+    grains.increment[slot] = reverse ? -playbackRate : playbackRate;
+    grains.pan[slot] = pan;
+    grains.startOffset[slot] = startOffset;
+
+    // Output matrix from the two capture channels. Pan gains as before
+    // (pan=0.0 → left only, pan=1.0 → right only).
+    const float leftGain = 1.0f - pan;
+    const float rightGain = pan;
+
+    if (settings.midSide)
+    {
+        // Pan places the mid; the (scaled, possibly inverted) side stays on both sides
+        const float side = 0.5f * width * (swap ? -1.0f : 1.0f);
+        grains.leftFromCh0[slot] = leftGain;
+        grains.leftFromCh1[slot] = side;
+        grains.rightFromCh0[slot] = rightGain;
+        grains.rightFromCh1[slot] = -side;
+    }
+    else
     {
-        generateHannWindow(grainSizeSamples);
+        // L/R pair narrowed around its own mid, optionally swapped, then balanced by pan
+        const float direct = 0.5f * (1.0f + width);
+        const float cross = 0.5f * (1.0f - width);
+        grains.leftFromCh0[slot] = leftGain * (swap ? cross : direct);
+        grains.leftFromCh1[slot] = leftGain * (swap ? direct : cross);
+        grains.rightFromCh0[slot] = rightGain * (swap ? direct : cross);
+        grains.rightFromCh1[slot] = rightGain * (swap ? cross : direct);
     }
+
+    // Read position: delay_time behind the capture position of the onset sample.
+    // Forward grains faster than 1x close in on the write head, so they start far
+    // enough back never to overtake it.
+    float delaySamples = static_cast<float>(currentSampleRate) * settings.delayTimeMs / 1000.0f;
+
+    if (! reverse && playbackRate > 1.0f)
+        delaySamples = juce::jmax(delaySamples, (playbackRate - 1.0f) * static_cast<float>(grainSizeSamples));
+
+    // Plus a full chunk, because the current chunk is captured after its grains are rendered
+    delaySamples += static_cast<float>(processChunkSize + GrainCaptureBuffer::guardSamples);
+    grains.readPosition[slot] = captureBuffer.wrap(static_cast<double>(blockStartPosition + startOffset) - delaySamples);
 }
 
-void ScatterAudioProcessor::updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote)
+void ScatterAudioProcessor::updateGrainScheduler(int numSamples, const GrainSpawnSettings& settings)
 {
     // Grain spawn interval calculation: grainSizeSamples / (density * overlapFactor)
     // At 50% density, grains spawn at ~grainSize intervals (moderate overlap)
     // At 100% density, grains spawn more frequently (dense cloud)
 
     const float overlapFactor = 2.0f;  // Tuning constant for overlap behavior
-    int grainSizeSamples = static_cast<int>(currentSampleRate * grainSizeMs / 1000.0f);
-    grainSizeSamples = juce::jmax(1, grainSizeSamples);
-
-    // Calculate spawn interval (avoid division by zero)
-    float densityNormalized = juce::jmax(0.01f, densityPercent / 100.0f);
-    int spawnInterval = static_cast<int>(grainSizeSamples / (densityNormalized * overlapFactor));
-    spawnInterval = juce::jmax(1, spawnInterval);  // At least 1 sample
-
-    lastGrainSpawnInterval = spawnInterval;
-
-    // Increment sample counter
-    grainSpawnCounter++;
-
-    // Check if it's time to spawn a new grain
-    if (grainSpawnCounter >= spawnInterval)
+    float grainSizeSamples = static_cast<float>(currentSampleRate) * settings.grainSizeMs / 1000.0f;
+    grainSizeSamples = juce::jmax(1.0f, grainSizeSamples);
+
+    // Calculate spawn interval (avoid division by zero), kept fractional so
+    // the average onset rate is exact
+    float densityNormalized = juce::jmax(0.01f, settings.densityPercent / 100.0f);
+    float spawnInterval = grainSizeSamples / (densityNormalized * overlapFactor);
+    spawnInterval = juce::jmax(1.0f, spawnInterval);  // At least 1 sample
+
+    // Spawn every onset that falls inside this block at its exact sample offset.
+    // Each inter-onset interval is jittered around the mean to avoid a comb-like
+    // periodic texture.
+    while (samplesUntilNextGrain < numSamples)
     {
-        spawnNewGrain(grainSizeMs, pitchRandomPercent, panRandomPercent, scaleIndex, rootNote);
-        grainSpawnCounter = 0;  // Reset counter
+        const int onset = juce::jmax(0, static_cast<int>(samplesUntilNextGrain));
+        spawnNewGrain(onset, settings);
+
+        const float jitter = 1.0f + random.nextBipolar() * onsetJitter;
+        samplesUntilNextGrain += spawnInterval * jitter;
     }
+
+    samplesUntilNextGrain -= numSamples;
 }
 
-void ScatterAudioProcessor::processGrainVoices(juce::AudioBuffer<float>& buffer)
+void ScatterAudioProcessor::processGrainVoices(float* leftData, float* rightData, int numSamples,
+                                               GrainCaptureBuffer::Interpolation interpolation, pfs::WindowShape windowShape)
 {
-    const int numSamples = buffer.getNumSamples();
-    const int numChannels = buffer.getNumChannels();
+    // Clear the chunk's wet output (grains will be summed into it)
+    juce::FloatVectorOperations::clear(leftData, numSamples);
+    juce::FloatVectorOperations::clear(rightData, numSamples);
 
-    // Clear output buffer (grains will be summed into it)
-    buffer.clear();
+    float* source0 = grainScratch.data();
+    float* source1 = grainScratch.data() + processChunkSize;
+    float* envelope = windowScratch.data();
+    const auto& windowBank = pfs::WindowTables::get();
 
-    // Process each active grain voice
-    for (auto& grain : grainVoices)
+    // Process each active grain as one span (walks only live grains)
+    for (int n = 0; n < grains.getNumActive();)
     {
-        if (!grain.active)
-            continue;
+        const auto slot = static_cast<size_t>(grains.getActiveSlot(n));
+        const float increment = grains.increment[slot];
+        const float windowIncrement = grains.windowIncrement[slot];
+        const int sample = grains.startOffset[slot];
+        const int count = juce::jmin(numSamples - sample, grains.samplesRemaining[slot]);
 
-        // For each sample in the buffer
-        for (int sample = 0; sample < numSamples; ++sample)
+        if (count > 0)
         {
-            // Check if grain has completed
-            if (grain.windowPosition >= 1.0f)
-            {
-                grain.active = false;
-                break;
-            }
-
-            // Calculate window index (map 0.0-1.0 to 0..grainSizeSamples-1)
-            int windowIndex = static_cast<int>(grain.windowPosition * grain.grainSizeSamples);
-            windowIndex = juce::jlimit(0, grain.grainSizeSamples - 1, windowIndex);
-
-            // Get window envelope value (or 1.0 if table not generated yet)
-            float windowValue = 1.0f;
-            if (windowIndex < static_cast<int>(hannWindow.size()))
-            {
-                windowValue = hannWindow[windowIndex];
-            }
-
-            // Phase 3.3: Read from delay buffer (stereo, with channel selection)
-            // Use channel 0 for mono-like grain source (could randomize per grain in future)
-            float delaySamples = grain.readPosition;
-            float delayedSample = delayBuffer.popSample(0, delaySamples);
-
-            // Apply window envelope
-            float grainOutput = delayedSample * windowValue;
-
-            // Phase 3.3: Apply stereo panning
-            float leftGain = 1.0f - grain.pan;   // pan=0.0 → leftGain=1.0, pan=1.0 → leftGain=0.0
-            float rightGain = grain.pan;          // pan=0.0 → rightGain=0.0, pan=1.0 → rightGain=1.0
-
-            // Sum to output buffer (stereo)
-            if (numChannels >= 2)
-            {
-                auto* leftData = buffer.getWritePointer(0);
-                auto* rightData = buffer.getWritePointer(1);
-
-                leftData[sample] += grainOutput * leftGain;
-                rightData[sample] += grainOutput * rightGain;
-            }
-            else if (numChannels == 1)
-            {
-                // Mono output: mix both channels
-                auto* outputData = buffer.getWritePointer(0);
-                outputData[sample] += grainOutput;
-            }
-
-            // Advance grain window position (always at rate 1.0 - envelope progresses normally)
-            grain.windowPosition += 1.0f / grain.grainSizeSamples;
-
-            // Phase 3.3: Advance read position by playback rate (forward or reverse)
-            if (grain.reverse)
-            {
-                grain.readPosition -= grain.playbackRate;
-
-                // Wrap around if negative
-                if (grain.readPosition < 0.0f)
-                {
-                    grain.readPosition += currentDelayBufferSize;
-                }
-            }
-            else
-            {
-                grain.readPosition += grain.playbackRate;
-
-                // Wrap around if exceeds buffer size
-                if (grain.readPosition >= currentDelayBufferSize)
-                {
-                    grain.readPosition -= currentDelayBufferSize;
-                }
-            }
+            const float windowStart = grains.windowPosition[slot];
+
+            // Read the span from both capture channels (L/R or mid/side)
+            captureBuffer.read(interpolation, 0, grains.readPosition[slot], increment, source0, count);
+            captureBuffer.read(interpolation, 1, grains.readPosition[slot], increment, source1, count);
+
+            // Envelope for the span, read from the shared table by phase
+            windowBank.fill(windowShape, windowStart, windowIncrement, envelope, count);
+            juce::FloatVectorOperations::multiply(source0, envelope, count);
+            juce::FloatVectorOperations::multiply(source1, envelope, count);
+
+            // Phase 3.3: Stereo output matrix (pan, width, swap)
+            juce::FloatVectorOperations::addWithMultiply(leftData + sample, source0, grains.leftFromCh0[slot], count);
+            juce::FloatVectorOperations::addWithMultiply(leftData + sample, source1, grains.leftFromCh1[slot], count);
+            juce::FloatVectorOperations::addWithMultiply(rightData + sample, source0, grains.rightFromCh0[slot], count);
+            juce::FloatVectorOperations::addWithMultiply(rightData + sample, source1, grains.rightFromCh1[slot], count);
+
+            // Advance window and read head by the span (forward or reverse)
+            grains.windowPosition[slot] = windowStart + static_cast<float>(count) * windowIncrement;
+            grains.readPosition[slot] = captureBuffer.wrap(grains.readPosition[slot] + static_cast<double>(increment) * count);
+            grains.samplesRemaining[slot] -= count;
         }
+
+        // Later chunks render the grain from their first sample
+        grains.startOffset[slot] = 0;
+
+        if (grains.samplesRemaining[slot] <= 0)
+            grains.retire(n);  // Swap-remove: slot n now holds an unprocessed grain
+        else
+            ++n;
     }
 }
 
@@ -2,7 +2,12 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include <array>
+#include <atomic>
 #include <vector>
+#include "NoiseSource.h"
+#include "WindowTables.h"
+#include "GrainCaptureBuffer.h"
+#include "GrainPool.h"
 
 class ScatterAudioProcessor : public juce::AudioProcessor
 {
@@ -42,7 +47,8 @@ public:
         float pan;    // Pan position (0.0-1.0)
     };
 
-    // Phase 4.2: Public accessor for grain positions (thread-safe read)
+    // Phase 4.2: Public accessor for grain positions (message thread; copies the
+    // snapshot the audio thread published at the end of its last block)
     std::vector<GrainVisualizationData> getActiveGrainPositions() const;
 
 private:
@@ -50,35 +56,42 @@ private:
 
     // Phase 3.1: Core Granular Engine Components
 
-    // Grain voice structure
-    struct GrainVoice
-    {
-        float readPosition = 0.0f;      // Position in delay buffer (fractional samples)
-        float windowPosition = 0.0f;    // Position in window envelope (0.0-1.0)
-        int grainSizeSamples = 0;       // Duration of this grain in samples
-        float playbackRate = 1.0f;      // Playback speed (pitch shift)
-        float pan = 0.5f;               // Phase 3.3: Pan position (0.0 = left, 1.0 = right)
-        bool reverse = false;           // Phase 3.3: Reverse playback flag
-        bool active = false;            // Is this voice currently playing?
-    };
-
-    // DSP components (declare BEFORE parameters for initialization order)
-    juce::dsp::ProcessSpec spec;
-
-    // Granular delay buffer (Lagrange3rd interpolation for future pitch shifting)
-    juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayBuffer;
-
-    // Grain voice pool (64 pre-allocated voices)
-    static constexpr int maxGrainVoices = 64;
-    std::array<GrainVoice, maxGrainVoices> grainVoices;
-
-    // Grain scheduler state
-    int grainSpawnCounter = 0;         // Sample counter for grain spawning
-    int lastGrainSpawnInterval = 0;    // Cached spawn interval
-
-    // Window function lookup table (Hann window)
-    std::vector<float> hannWindow;
-    int windowTableSize = 0;
+    // Blocks are rendered in fixed chunks on a grid aligned to the capture
+    // position, so output and feedback don't depend on the host block size
+    static constexpr int processChunkSize = 32;
+
+    // Input capture (power-of-two ring, grains read spans with their own heads)
+    GrainCaptureBuffer captureBuffer;
+    int blockStartPosition = 0;        // Capture write position of the current chunk's first sample
+    std::array<float, 2 * processChunkSize> grainScratch {};    // One grain span per capture channel
+    std::array<float, 2 * processChunkSize> wetScratch {};      // Chunk grain output (L, R)
+    std::array<float, 2 * processChunkSize> captureScratch {};  // Chunk input + feedback (L, R)
+
+    // Grain voice pool (SoA, sized in prepareToPlay from max_grains)
+    GrainPool grains;
+    static int getMaxGrains(int choiceIndex);
+
+    // Phase 4.2: Grain dots for the editor. The pool is reallocated in
+    // prepareToPlay, so the editor never reads it: the audio thread copies the
+    // active grains here after each block (skipped while the editor holds the
+    // lock, so it never waits) and the editor copies them out under the lock.
+    static constexpr int maxVisualizedGrains = 256;
+    std::array<GrainVisualizationData, maxVisualizedGrains> grainSnapshot {};
+    int grainSnapshotSize = 0;
+    mutable juce::SpinLock grainSnapshotLock;
+    void publishGrainSnapshot();
+
+    // Grain scheduler state: samples from the current chunk start to the next onset.
+    // Carried across chunks, so onsets don't depend on the host block size.
+    double samplesUntilNextGrain = 0.0;
+    static constexpr float onsetJitter = 0.25f;  // ± fraction of the inter-onset interval
+
+    // Grain randomisation (pitch/pan/reverse); re-seeded from noiseSeed in prepareToPlay
+    pfs::NoiseSource random;
+    std::atomic<juce::int64> noiseSeed { 0 };  // Per-instance, saved with the state for reproducible renders
+
+    // Grain envelopes come from the shared, immutable pfs::WindowTables bank
+    std::array<float, processChunkSize> windowScratch {};  // One grain span of envelope
 
     // Sample rate tracking
     double currentSampleRate = 44100.0;
@@ -89,14 +102,31 @@ private:
     std::array<std::vector<int>, numScales> scaleIntervals;
 
     // Phase 3.3: Spatial + Reverse + Feedback components
-    juce::dsp::DryWetMixer<float> dryWetMixer;
-    juce::AudioBuffer<float> feedbackBuffer;
+    juce::SmoothedValue<float> mixSmoothed;  // Wet proportion, ramped per sample
+
+    // Per-block parameter snapshot used by the scheduler when spawning grains
+    struct GrainSpawnSettings
+    {
+        float delayTimeMs = 500.0f;
+        float grainSizeMs = 100.0f;
+        float densityPercent = 50.0f;
+        float pitchRandomPercent = 0.0f;
+        float panRandomPercent = 0.0f;
+        float widthRandomPercent = 0.0f;   // Phase 3.3: random narrowing of each grain's stereo image
+        float swapRandomPercent = 0.0f;    // Phase 3.3: probability of swapping a grain's L/R
+        int scaleIndex = 0;
+        int rootNote = 0;
+        int maxGrains = 256;
+        bool midSide = false;              // Capture is stored as mid/side
+    };
 
     // Helper methods
-    void spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
-    void updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
-    void processGrainVoices(juce::AudioBuffer<float>& buffer);
-    void generateHannWindow(int sizeInSamples);
+    void spawnNewGrain(int startOffset, const GrainSpawnSettings& settings);
+    void updateGrainScheduler(int numSamples, const GrainSpawnSettings& settings);
+    void processChunk(float* left, float* right, int numSamples, const GrainSpawnSettings& settings,
+                      float feedbackGain, GrainCaptureBuffer::Interpolation interpolation, pfs::WindowShape windowShape);
+    void processGrainVoices(float* leftData, float* rightData, int numSamples,
+                            GrainCaptureBuffer::Interpolation interpolation, pfs::WindowShape windowShape);
     void initializeScaleTables();
     int quantizePitchToScale(float pitchSemitones, int scaleIndex, int rootNote);
 
@@ -101,14 +101,14 @@ SektorAudioProcessorEditor::SektorAudioProcessorEditor(SektorAudioProcessor& p)
     addAndMakeVisible(*webView);
 
     // Drag-and-drop is enabled by FileDragAndDropTarget interface
-    std::cout << "[SEKTOR INIT] Drag-and-drop interface registered (FileDragAndDropTarget)" << std::endl;
+    pfs::Trace::message("Sektor", "[INIT] Drag-and-drop interface registered (FileDragAndDropTarget)");
 
     // Set editor size (match mockup: 900×600)
     setSize(900, 600);
 
     // Navigate to UI
     webView->goToURL(juce::WebBrowserComponent::getResourceProviderRoot());
-    std::cout << "[SEKTOR INIT] Editor initialized successfully with " << SektorAudioProcessor::MaxRegions << " regions" << std::endl;
+    pfs::Trace::message("Sektor", "[INIT] Editor initialized successfully with " + juce::String(SektorAudioProcessor::MaxRegions) + " regions");
 
     // Start playhead visualization timer (30 FPS for smooth animation)
     startTimer(33);  // ~30 Hz
@@ -175,17 +175,17 @@ SektorAudioProcessorEditor::getResource(const juce::String& url)
 // FileDragAndDropTarget implementation
 bool SektorAudioProcessorEditor::isInterestedInFileDrag(const juce::StringArray& files)
 {
-    std::cout << "[SEKTOR DRAG] isInterestedInFileDrag called with " << files.size() << " files" << std::endl;
+    pfs::Trace::message("Sektor", "[DRAG] isInterestedInFileDrag called with " + juce::String(files.size()) + " files");
 
     for (const auto& file : files) {
-        std::cout << "[SEKTOR DRAG] Checking file: " << file.toStdString() << std::endl;
+        pfs::Trace::message("Sektor", "[DRAG] Checking file: " + file);
         juce::File f(file);
         if (f.hasFileExtension("wav;aif;aiff;mp3;flac")) {
-            std::cout << "[SEKTOR DRAG] ✓ File is audio format, interested!" << std::endl;
+            pfs::Trace::message("Sektor", "[DRAG] File is audio format, interested!");
             return true;
         }
     }
-    std::cout << "[SEKTOR DRAG] ✗ No audio files found, not interested" << std::endl;
+    pfs::Trace::message("Sektor", "[DRAG] No audio files found, not interested");
     return false;
 }
 
@@ -193,15 +193,15 @@ void SektorAudioProcessorEditor::filesDropped(const juce::StringArray& files, in
 {
     juce::ignoreUnused(x, y);
 
-    std::cout << "[SEKTOR DROP] Files dropped count: " << files.size() << std::endl;
+    pfs::Trace::message("Sektor", "[DROP] Files dropped count: " + juce::String(files.size()));
 
     if (!files.isEmpty()) {
         juce::File droppedFile(files[0]);
-        std::cout << "[SEKTOR DROP] File path: " << droppedFile.getFullPathName().toStdString() << std::endl;
-        std::cout << "[SEKTOR DROP] File exists: " << (droppedFile.exists() ? "YES" : "NO") << std::endl;
+        pfs::Trace::message("Sektor", "[DROP] File path: " + droppedFile.getFullPathName());
+        pfs::Trace::message("Sektor", "[DROP] File exists: " + juce::String(droppedFile.exists() ? "YES" : "NO"));
         loadSampleAsync(droppedFile);
     } else {
-        std::cout << "[SEKTOR DROP] ERROR: No files in array!" << std::endl;
+        pfs::Trace::message("Sektor", "[DROP] ERROR: No files in array!");
     }
 }
 
@@ -209,7 +209,7 @@ void SektorAudioProcessorEditor::filesDropped(const juce::StringArray& files, in
 void SektorAudioProcessorEditor::loadSampleAsync(const juce::File& file)
 {
     // Debug log: file selection
-    std::cout << "[SEKTOR SAMPLE] Starting load of: " << file.getFullPathName().toStdString() << std::endl;
+    pfs::Trace::message("Sektor", "[SAMPLE] Starting load of: " + file.getFullPathName());
 
     // Show loading indicator
     updateUIStatus("Loading sample...");
@@ -219,21 +219,21 @@ void SektorAudioProcessorEditor::loadSampleAsync(const juce::File& file)
         juce::AudioFormatManager formatManager;
         formatManager.registerBasicFormats();
 
-        std::cout << "[SEKTOR SAMPLE] Creating reader for: " << file.getFileName().toStdString() << std::endl;
+        pfs::Trace::message("Sektor", "[SAMPLE] Creating reader for: " + file.getFileName());
 
         auto reader = std::unique_ptr<juce::AudioFormatReader>(formatManager.createReaderFor(file));
         if (reader == nullptr) {
-            std::cout << "[SEKTOR SAMPLE] ERROR: Failed to create reader - invalid format" << std::endl;
+            pfs::Trace::message("Sektor", "[SAMPLE] ERROR: Failed to create reader - invalid format");
             juce::MessageManager::callAsync([this]() {
                 updateUIStatus("Error: Invalid audio file");
             });
             return;
         }
 
-        std::cout << "[SEKTOR SAMPLE] Reader created successfully" << std::endl;
-        std::cout << "[SEKTOR SAMPLE]   Channels: " << reader->numChannels << std::endl;
-        std::cout << "[SEKTOR SAMPLE]   Length: " << reader->lengthInSamples << " samples" << std::endl;
-        std::cout << "[SEKTOR SAMPLE]   Sample rate: " << reader->sampleRate << " Hz" << std::endl;
+        pfs::Trace::message("Sektor", "[SAMPLE] Reader created successfully");
+        pfs::Trace::message("Sektor", "[SAMPLE]   Channels: " + juce::String(reader->numChannels));
+        pfs::Trace::message("Sektor", "[SAMPLE]   Length: " + juce::String(reader->lengthInSamples) + " samples");
+        pfs::Trace::message("Sektor", "[SAMPLE]   Sample rate: " + juce::String(reader->sampleRate) + " Hz");
 
         // Load sample into temporary buffer
         auto tempBuffer = std::make_unique<juce::AudioBuffer<float>>(
@@ -241,20 +241,20 @@ void SektorAudioProcessorEditor::loadSampleAsync(const juce::File& file)
             static_cast<int>(reader->lengthInSamples)
         );
 
-        std::cout << "[SEKTOR SAMPLE] Reading audio data..." << std::endl;
+        pfs::Trace::message("Sektor", "[SAMPLE] Reading audio data...");
         reader->read(tempBuffer.get(), 0, static_cast<int>(reader->lengthInSamples), 0, true, true);
-        std::cout << "[SEKTOR SAMPLE] Audio data loaded successfully" << std::endl;
+        pfs::Trace::message("Sektor", "[SAMPLE] Audio data loaded successfully");
 
         // Send waveform data to UI before moving buffer
         sendWaveformDataToJS(*tempBuffer);
 
         // Atomic swap in processor (thread-safe)
         processorRef.setSampleBuffer(std::move(tempBuffer));
-        std::cout << "[SEKTOR SAMPLE] Sample buffer swapped in processor" << std::endl;
+        pfs::Trace::message("Sektor", "[SAMPLE] Sample buffer swapped in processor");
 
         // Update UI on message thread
         juce::MessageManager::callAsync([this, filename = file.getFileName()]() {
-            std::cout << "[SEKTOR SAMPLE] Updating UI with filename: " << filename.toStdString() << std::endl;
+            pfs::Trace::message("Sektor", "[SAMPLE] Updating UI with filename: " + filename);
             updateUIStatus("Sample loaded: " + filename);
         });
 
@@ -317,17 +317,17 @@ void SektorAudioProcessorEditor::loadAudioFromBase64(const juce::String& base64D
 
 void SektorAudioProcessorEditor::updateUIStatus(const juce::String& message)
 {
-    std::cout << "[SEKTOR UI] Updating UI status: " << message.toStdString() << std::endl;
+    pfs::Trace::message("Sektor", "[UI] Updating UI status: " + message);
 
     // Send status update to JavaScript via evaluateJavascript
     if (webView) {
-        std::cout << "[SEKTOR UI] WebView exists, executing JavaScript..." << std::endl;
+        pfs::Trace::message("Sektor", "[UI] WebView exists, executing JavaScript...");
         juce::String escapedMessage = message.replace("'", "\\'");
         juce::String jsCode = "if (window.updateStatus) { window.updateStatus('" + escapedMessage + "'); } else { console.error('updateStatus function not found'); }";
-        std::cout << "[SEKTOR UI] JS Code: " << jsCode.toStdString() << std::endl;
+        pfs::Trace::message("Sektor", "[UI] JS Code: " + jsCode);
         webView->evaluateJavascript(jsCode);
     } else {
-        std::cout << "[SEKTOR UI] ERROR: WebView is null!" << std::endl;
+        pfs::Trace::message("Sektor", "[UI] ERROR: WebView is null!");
     }
 }
 
@@ -336,7 +336,7 @@ void SektorAudioProcessorEditor::openFileBrowser()
     // IMPORTANT: FileChooser must run on message thread
     // Native functions may be called from other threads, so force message thread
     juce::MessageManager::callAsync([this]() {
-        std::cout << "[SEKTOR BROWSE] Opening file browser dialog..." << std::endl;
+        pfs::Trace::message("Sektor", "[BROWSE] Opening file browser dialog...");
 
         fileChooser = std::make_unique<juce::FileChooser>(
             "Load audio sample",
@@ -349,10 +349,10 @@ void SektorAudioProcessorEditor::openFileBrowser()
             [this](const juce::FileChooser& chooser) {
                 auto selectedFile = chooser.getResult();
                 if (selectedFile.exists()) {
-                    std::cout << "[SEKTOR BROWSE] User selected: " << selectedFile.getFullPathName().toStdString() << std::endl;
+                    pfs::Trace::message("Sektor", "[BROWSE] User selected: " + selectedFile.getFullPathName());
                     loadSampleAsync(selectedFile);
                 } else {
-                    std::cout << "[SEKTOR BROWSE] User cancelled file selection" << std::endl;
+                    pfs::Trace::message("Sektor", "[BROWSE] User cancelled file selection");
                 }
             }
         );
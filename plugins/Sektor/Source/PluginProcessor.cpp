@@ -29,10 +29,6 @@ void SektorAudioProcessor::Voice::prepare(double sampleRate, int maxGrainSize)
 
     // NOTE: Test sample generation removed - voices now use shared buffer via setSourceBuffer()
     // generateTestSample(sampleRate);  // Kept for reference, not called automatically
-
-    // Pre-generate Hann window for common grain sizes
-    // We'll regenerate dynamically in processBlock for now
-    hannWindow.resize(maxGrainSize);
 }
 
 void SektorAudioProcessor::Voice::setSourceBuffer(const juce::AudioBuffer<float>* newBuffer)
@@ -48,19 +44,6 @@ void SektorAudioProcessor::Voice::generateTestSample(double sampleRate)
     juce::ignoreUnused(sampleRate);
 }
 
-void SektorAudioProcessor::Voice::generateHannWindow(int grainSize)
-{
-    // Resize and regenerate Hann window for current grain size
-    hannWindow.resize(grainSize);
-
-    for (int i = 0; i < grainSize; ++i)
-    {
-        // Hann window formula: 0.5 * (1 - cos(2π * i / (N-1)))
-        float phase = juce::MathConstants<float>::twoPi * static_cast<float>(i) / static_cast<float>(grainSize - 1);
-        hannWindow[i] = 0.5f * (1.0f - std::cos(phase));
-    }
-}
-
 void SektorAudioProcessor::Voice::startNote(int midiNote, float velocity)
 {
     midiNoteNumber = midiNote;
@@ -218,6 +201,7 @@ void SektorAudioProcessor::Voice::generateGrain(int grainSamples, float spacing,
     targetGrain->readPosition = 0.0f;
     targetGrain->samplesRemaining = grainSamples;
     targetGrain->grainStartPhase = regionStartSamples + grainPhase;  // Absolute position in sample buffer
+    targetGrain->windowIncrement = 1.0f / static_cast<float>(grainSamples);
     targetGrain->isActive = true;
 
     // Update absolute position for playhead visualization
@@ -268,7 +252,7 @@ float SektorAudioProcessor::Voice::readFractionalSample(float position)
 
 void SektorAudioProcessor::Voice::processBlock(juce::AudioBuffer<float>& output, int numSamples,
                                                 float grainSizeMs, float density, float pitchShiftSemitones, float spacing,
-                                                const std::vector<RegionData>& regions)
+                                                pfs::WindowShape windowShape, const std::vector<RegionData>& regions)
 {
     // Safety check: Ensure buffer is loaded
     if (state == IDLE || sourceBuffer == nullptr || sourceBuffer->getNumSamples() == 0)
@@ -278,11 +262,9 @@ void SektorAudioProcessor::Voice::processBlock(juce::AudioBuffer<float>& output,
     int grainSamples = static_cast<int>((grainSizeMs / 1000.0f) * static_cast<float>(currentSampleRate));
     grainSamples = juce::jlimit(100, maxGrainSamples, grainSamples);  // Clamp to reasonable range
 
-    // Regenerate Hann window if grain size changed
-    if (hannWindow.size() != static_cast<size_t>(grainSamples))
-    {
-        generateHannWindow(grainSamples);
-    }
+    // Grain envelopes are read by phase from the shared window bank, so a grain
+    // keeps its own length when GRAIN_SIZE moves mid-grain
+    const auto& windowBank = pfs::WindowTables::get();
 
     // Calculate pitch shift rate (semitones to playback rate)
     float pitchRate = std::pow(2.0f, pitchShiftSemitones / 12.0f);
@@ -318,13 +300,8 @@ void SektorAudioProcessor::Voice::processBlock(juce::AudioBuffer<float>& output,
             // Read sample with linear interpolation
             float sampleValue = readFractionalSample(sourcePosition);
 
-            // Apply Hann window
-            int windowIndex = static_cast<int>(grain.readPosition);
-            if (windowIndex >= 0 && windowIndex < grainSamples)
-            {
-                float windowValue = hannWindow[windowIndex];
-                outputSample += sampleValue * windowValue;
-            }
+            // Apply grain window
+            outputSample += sampleValue * windowBank.lookup(windowShape, grain.readPosition * grain.windowIncrement);
 
             // Advance grain read position
             grain.readPosition += 1.0f;
@@ -473,16 +450,27 @@ void SektorAudioProcessor::VoiceManager::handleAllNotesOff()
     }
 }
 
+bool SektorAudioProcessor::VoiceManager::anyVoiceActive() const
+{
+    for (const auto& voice : voices)
+    {
+        if (voice.isActive())
+            return true;
+    }
+
+    return false;
+}
+
 void SektorAudioProcessor::VoiceManager::processBlock(juce::AudioBuffer<float>& output, int numSamples,
                                                        float grainSizeMs, float density, float pitchShiftSemitones, float spacing,
-                                                       const std::vector<RegionData>& regions)
+                                                       pfs::WindowShape windowShape, const std::vector<RegionData>& regions)
 {
     // Process all active voices
     for (auto& voice : voices)
     {
         if (voice.isActive())
         {
-            voice.processBlock(output, numSamples, grainSizeMs, density, pitchShiftSemitones, spacing, regions);
+            voice.processBlock(output, numSamples, grainSizeMs, density, pitchShiftSemitones, spacing, windowShape, regions);
         }
     }
 
@@ -581,6 +569,14 @@ juce::AudioProcessorValueTreeState::ParameterLayout SektorAudioProcessor::create
         ));
     }
 
+    // WINDOW_SHAPE - Grain envelope
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "WINDOW_SHAPE", 1 },
+        "Window Shape",
+        juce::StringArray { "Hann", "Tukey", "Blackman", "Gaussian", "Trapezoid" },
+        0  // Default: Hann
+    ));
+
     // POLYPHONY_MODE - Mono (false) or Poly (true)
     layout.add(std::make_unique<juce::AudioParameterBool>(
         juce::ParameterID { "POLYPHONY_MODE", 1 },
@@ -596,6 +592,8 @@ SektorAudioProcessor::SektorAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))  // Output-only (instrument)
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    // Build the shared window bank now rather than on the first audio callback
+    pfs::WindowTables::get();
 }
 
 SektorAudioProcessor::~SektorAudioProcessor()
@@ -608,6 +606,8 @@ void SektorAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     int maxGrainSize = static_cast<int>((500.0 / 1000.0) * sampleRate);
     voiceManager.prepare(sampleRate, maxGrainSize);
 
+    silence.prepare(sampleRate, 0.05);
+
     juce::ignoreUnused(samplesPerBlock);
 }
 
@@ -619,6 +619,14 @@ void SektorAudioProcessor::releaseResources()
 void SektorAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    pfs::TraceScope blockTrace("Sektor::processBlock", buffer.getNumSamples());
+
+    // Idle instance: no voice sounding and nothing to trigger
+    if (silence.isIdle(voiceManager.anyVoiceActive(), midiMessages))
+    {
+        pfs::SilenceTracker::outputSilence(buffer);
+        return;
+    }
 
     // Clear output buffer
     buffer.clear();
@@ -635,6 +643,7 @@ void SektorAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
     float pitchShiftSemitones = pitchShiftParam->load();
     float spacing = spacingParam->load();
     bool polyMode = (polyphonyModeParam->load() >= 0.5f);
+    auto windowShape = static_cast<pfs::WindowShape>(static_cast<int>(parameters.getRawParameterValue("WINDOW_SHAPE")->load()));
 
     // Collect all region data (5 regions)
     std::vector<RegionData> currentRegions(MaxRegions);
@@ -648,26 +657,25 @@ void SektorAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
         currentRegions[i].active = parameters.getRawParameterValue("REGION_ACTIVE" + idSuffix)->load() > 0.5f;
     }
 
-    // Debug logging (every ~1 second to avoid spam)
-    static int frameCounter = 0;
-    frameCounter += buffer.getNumSamples();
-    if (frameCounter >= 44100)  // Log every ~1 second at 44.1kHz
+    // Parameter snapshot for the trace log (every ~1 second; no-op unless tracing is enabled)
+    if (pfs::Trace::isEnabled())
     {
-        frameCounter = 0;
-        
-        // Count active regions for debug output
-        int activeCount = 0;
-        for (const auto& region : currentRegions)
+        traceSampleCounter += buffer.getNumSamples();
+
+        if (traceSampleCounter >= static_cast<int>(getSampleRate()))
         {
-            if (region.active) activeCount++;
+            traceSampleCounter = 0;
+
+            int activeCount = 0;
+            for (const auto& region : currentRegions)
+            {
+                if (region.active) activeCount++;
+            }
+
+            pfs::Trace::instant("Sektor.grainSize.density", grainSizeMs, density);
+            pfs::Trace::instant("Sektor.pitch.spacing", pitchShiftSemitones, spacing);
+            pfs::Trace::instant("Sektor.activeRegions.poly", activeCount, polyMode ? 1.0 : 0.0);
         }
-        
-        std::cout << "[SEKTOR] GrainSize: " << grainSizeMs << "ms | "
-                  << "Density: " << density << " | "
-                  << "Pitch: " << pitchShiftSemitones << " semitones | "
-                  << "Spacing: " << spacing << " | "
-                  << "Active Regions: " << activeCount << "/" << MaxRegions << " | "
-                  << "PolyMode: " << (polyMode ? "POLY" : "MONO") << std::endl;
     }
 
     // Process MIDI messages (note-on/note-off)
@@ -694,7 +702,9 @@ void SektorAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::
     }
 
     // Process all active voices with multi-region support
-    voiceManager.processBlock(buffer, buffer.getNumSamples(), grainSizeMs, density, pitchShiftSemitones, spacing, currentRegions);
+    voiceManager.processBlock(buffer, buffer.getNumSamples(), grainSizeMs, density, pitchShiftSemitones, spacing, windowShape, currentRegions);
+
+    silence.trackTail(buffer, voiceManager.anyVoiceActive());
 }
 
 juce::AudioProcessorEditor* SektorAudioProcessor::createEditor()
@@ -761,12 +771,12 @@ void SektorAudioProcessor::setSampleBuffer(std::unique_ptr<juce::AudioBuffer<flo
     // Debug logging
     if (rawPtr != nullptr)
     {
-        std::cout << "[PROCESSOR] New buffer set. Samples: " << rawPtr->getNumSamples()
-                  << " | Channels: " << rawPtr->getNumChannels() << std::endl;
+        pfs::Trace::message("Sektor", "[PROCESSOR] New buffer set. Samples: " + juce::String(rawPtr->getNumSamples())
+                                          + " | Channels: " + juce::String(rawPtr->getNumChannels()));
     }
     else
     {
-        std::cout << "[PROCESSOR] Buffer cleared (nullptr)" << std::endl;
+        pfs::Trace::message("Sektor", "[PROCESSOR] Buffer cleared (nullptr)");
     }
 
     // Delete old buffer on message thread (safe disposal)
@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include "SilenceTracker.h"
+#include "Trace.h"
+#include "WindowTables.h"
 #include <vector>
 #include <cmath>
 
@@ -68,9 +71,10 @@ private:
         float readPosition;     // Current fractional read position in grain
         int samplesRemaining;   // Samples until grain finishes
         float grainStartPhase;  // Sample position in source where grain started
+        float windowIncrement;  // Window phase step per sample (1 / grain length at spawn)
         bool isActive;
 
-        ActiveGrain() : readPosition(0.0f), samplesRemaining(0), grainStartPhase(0.0f), isActive(false) {}
+        ActiveGrain() : readPosition(0.0f), samplesRemaining(0), grainStartPhase(0.0f), windowIncrement(0.0f), isActive(false) {}
     };
 
     // Voice class for overlapping grain playback
@@ -89,7 +93,7 @@ private:
         void triggerQuickRelease();
         void processBlock(juce::AudioBuffer<float>& output, int numSamples,
                          float grainSizeMs, float density, float pitchShiftSemitones, float spacing,
-                         const std::vector<RegionData>& regions);
+                         pfs::WindowShape windowShape, const std::vector<RegionData>& regions);
 
         bool isPlaying() const { return state == PLAYING; }
         bool isActive() const { return state != IDLE; }
@@ -101,7 +105,6 @@ private:
 
     private:
         void generateTestSample(double sampleRate);
-        void generateHannWindow(int grainSize);
         void generateGrain(int grainSamples, float spacing, const std::vector<RegionData>& regions);
         const RegionData& getRandomActiveRegion(const std::vector<RegionData>& regions);
         float readFractionalSample(float position);
@@ -110,7 +113,6 @@ private:
         juce::Random rng;  // Random generator for region selection
 
         const juce::AudioBuffer<float>* sourceBuffer = nullptr;  // Pointer to shared sample buffer
-        std::vector<float> hannWindow;          // Pre-calculated Hann window
 
         static constexpr int MAX_ACTIVE_GRAINS = 8;  // CPU protection
         std::vector<ActiveGrain> activeGrains;
@@ -145,9 +147,10 @@ private:
         void handleAllNotesOff();
         void processBlock(juce::AudioBuffer<float>& output, int numSamples,
                          float grainSizeMs, float density, float pitchShiftSemitones, float spacing,
-                         const std::vector<RegionData>& regions);
+                         pfs::WindowShape windowShape, const std::vector<RegionData>& regions);
 
         const std::vector<Voice>& getVoices() const { return voices; }
+        bool anyVoiceActive() const;
 
     private:
         Voice* allocateVoice(int noteNumber, bool monoMode);
@@ -159,5 +162,12 @@ private:
     // DSP Components
     VoiceManager voiceManager;  // Phase 2.3: Full polyphonic voice management
 
+    // Idle-instance fast path (no active voice, no note-on → skip the block)
+    pfs::SilenceTracker silence;
+
+    // Diagnostics: shared trace writer thread, and the sample count since the last parameter snapshot
+    juce::SharedResourcePointer<pfs::TraceWriter> traceWriter;
+    int traceSampleCounter = 0;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SektorAudioProcessor)
 };
@@ -100,8 +100,8 @@ void TapeAgeAudioProcessorEditor::resized()
 void TapeAgeAudioProcessorEditor::timerCallback()
 {
     // Phase 5.2: Send VU meter updates to JavaScript
-    // Read peak level from audio processor (atomic, thread-safe)
-    float dbLevel = processorRef.outputLevel.load(std::memory_order_relaxed);
+    // Highest true peak since the last frame, from the meter's lock-free history
+    float dbLevel = processorRef.outputMeter.readSince(meterPosition).truePeakDb;
 
     // Emit event to JavaScript (only if WebView is visible)
     webView->emitEventIfBrowserIsVisible("updateVUMeter", dbLevel);
@@ -15,6 +15,7 @@ public:
 
 private:
     TapeAgeAudioProcessor& processorRef;
+    juce::uint64 meterPosition = 0;  // Read cursor into the processor's meter history
 
     // ⚠️ CRITICAL: Member declaration order prevents release build crashes
     // Destruction happens in REVERSE order of declaration
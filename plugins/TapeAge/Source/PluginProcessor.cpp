@@ -45,6 +45,54 @@ juce::AudioProcessorValueTreeState::ParameterLayout TapeAgeAudioProcessor::creat
         0.0f  // Default: 0dB (unity gain)
     ));
 
+    // oversampling - Saturation oversampling factor (Off / 2x / 4x / 8x)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversampling", 1 },
+        "Oversampling",
+        juce::StringArray { "Off", "2x", "4x", "8x" },
+        1  // Default: 2x
+    ));
+
+    // oversampling_filter - Half-band filter type (IIR: minimal latency, FIR: linear phase)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "oversampling_filter", 1 },
+        "Oversampling Filter",
+        juce::StringArray { "IIR", "Linear Phase" },
+        1  // Default: linear-phase FIR
+    ));
+
+    // render_oversampling - Quality used while the host renders offline
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "render_oversampling", 1 },
+        "Render Oversampling",
+        juce::StringArray { "Same as Realtime", "4x", "8x" },
+        2  // Default: 8x linear phase
+    ));
+
+    // saturation_aa - Antiderivative anti-aliasing of the tanh saturator
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "saturation_aa", 1 },
+        "Saturation Anti-Aliasing",
+        juce::StringArray { "Off", "1st Order", "2nd Order" },
+        1  // Default: 1st order
+    ));
+
+    // hysteresis - Tape memory term (direction-dependent saturation)
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID { "hysteresis", 1 },
+        "Hysteresis",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f, 1.0f),  // 0-100%, linear
+        0.0f  // Default: off (plain tanh curve)
+    ));
+
+    // modulation_mode - Wow/flutter delay centred on 100ms (Classic) or a one-sided swing above 2ms (Low Latency)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "modulation_mode", 1 },
+        "Modulation Mode",
+        juce::StringArray { "Classic", "Low Latency" },
+        0  // Default: Classic
+    ));
+
     return layout;
 }
 
@@ -52,9 +100,12 @@ TapeAgeAudioProcessor::TapeAgeAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , oversampler(2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple)  // 2x oversampling, 1 stage, FIR filters
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    // Fresh instances get their own noise seed so stacked TapeAge instances don't
+    // produce correlated hiss; the seed is stored with the state (see setStateInformation)
+    noiseSeed = juce::Random().nextInt64();
+    parameters.state.setProperty("noiseSeed", noiseSeed.load(), nullptr);
 }
 
 TapeAgeAudioProcessor::~TapeAgeAudioProcessor()
@@ -69,9 +120,26 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     currentSpec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
     currentSampleRate = sampleRate;
 
-    // Phase 4.1: Prepare oversampling engine
-    oversampler.initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampler.reset();
+    // Phase 4.1: Prepare one oversampling engine per quality setting, so the
+    // quality (and offline render upgrade) can change without allocating
+    for (int filter = 0; filter < 2; ++filter)
+    {
+        const auto filterType = filter == 0 ? juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR
+                                            : juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple;
+
+        for (int factor = 0; factor < numOversamplingFactors; ++factor)
+        {
+            // Integer latency so the reported PDC is exact
+            auto& stage = oversamplers[static_cast<size_t>(filter * numOversamplingFactors + factor)];
+            stage = std::make_unique<juce::dsp::Oversampling<float>>(juce::jmax(1u, currentSpec.numChannels), static_cast<size_t>(factor),
+                                                                     filterType, true, true);
+            stage->initProcessing(static_cast<size_t>(samplesPerBlock));
+        }
+    }
+
+    activeOversampler = getOversamplerIndex();
+    oversamplers[static_cast<size_t>(activeOversampler)]->reset();
+    saturator.reset();
 
     // Phase 4.2: Prepare wow/flutter modulation
     // 200ms delay line buffer for pitch modulation (architecture.md line 28)
@@ -80,13 +148,16 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     delayLine.prepare(currentSpec);
     delayLine.reset();
 
+    // Restart the noise stream so renders from here are reproducible
+    random.setSeed(static_cast<uint64_t>(noiseSeed.load()));
+
     // Initialize random phase offsets per channel for stereo width
-    lfoPhase[0] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-    lfoPhase[1] = random.nextFloat() * juce::MathConstants<float>::twoPi;
+    lfoPhase[0] = random.nextUniform() * juce::MathConstants<float>::twoPi;
+    lfoPhase[1] = random.nextUniform() * juce::MathConstants<float>::twoPi;
 
     // v1.1.0: Initialize flutter LFO with different random phase
-    flutterPhase[0] = random.nextFloat() * juce::MathConstants<float>::twoPi;
-    flutterPhase[1] = random.nextFloat() * juce::MathConstants<float>::twoPi;
+    flutterPhase[0] = random.nextUniform() * juce::MathConstants<float>::twoPi;
+    flutterPhase[1] = random.nextUniform() * juce::MathConstants<float>::twoPi;
 
     // Phase 4.3: Prepare degradation features
     // Initialize dropout state (no dropout at start)
@@ -98,6 +169,7 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     // Initialize noise filter state to zero
     noiseFilterState[0] = 0.0f;
     noiseFilterState[1] = 0.0f;
+    noiseBuffer.assign(static_cast<size_t>(samplesPerBlock), 0.0f);
 
     // v1.1.0: Prepare age-dependent high-frequency rolloff filters
     for (int i = 0; i < 2; ++i)
@@ -113,17 +185,68 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     dryWetMixer.prepare(currentSpec);
     dryWetMixer.reset();
 
+    // Phase 5.2: Output meter (the VU shows true peak only)
+    outputMeter.prepare(sampleRate, getTotalNumOutputChannels(), pfs::LevelMeter::Measurements::peaksOnly);
+
     // Set wet latency to compensate for oversampler + delay line latency
-    int oversamplerLatency = static_cast<int>(oversampler.getLatencyInSamples());
-    int delayLineLatency = static_cast<int>(sampleRate * 0.1);  // 100ms base delay from wow/flutter
-    int totalWetLatency = oversamplerLatency + delayLineLatency;
-    dryWetMixer.setWetLatency(static_cast<float>(totalWetLatency));
+    lowLatencyModulation = parameters.getRawParameterValue("modulation_mode")->load() >= 0.5f;
+    saturationMode = getSaturationModeParameter();
+    updateLatency();
+}
+
+TapeSaturator::Mode TapeAgeAudioProcessor::getSaturationModeParameter() const
+{
+    return static_cast<TapeSaturator::Mode>(static_cast<int>(parameters.getRawParameterValue("saturation_aa")->load()));
+}
+
+int TapeAgeAudioProcessor::getOversamplerIndex() const
+{
+    int factor = static_cast<int>(parameters.getRawParameterValue("oversampling")->load());
+    bool linearPhase = parameters.getRawParameterValue("oversampling_filter")->load() >= 0.5f;
+
+    // Offline renders upgrade to the render quality (never below the realtime setting)
+    if (isNonRealtime())
+    {
+        const int renderChoice = static_cast<int>(parameters.getRawParameterValue("render_oversampling")->load());
+
+        if (renderChoice > 0)
+        {
+            factor = juce::jmax(factor, renderChoice + 1);  // 1 = 4x, 2 = 8x
+            linearPhase = true;
+        }
+    }
+
+    return (linearPhase ? numOversamplingFactors : 0) + juce::jlimit(0, numOversamplingFactors - 1, factor);
+}
+
+float TapeAgeAudioProcessor::getBaseDelaySamples() const
+{
+    // Classic: modulation swings around a 100ms centre. Low latency: modulation only
+    // ever adds delay on top of a 2ms floor, so the floor is all the host compensates.
+    return static_cast<float>(currentSampleRate) * (lowLatencyModulation ? 0.002f : 0.1f);
+}
+
+void TapeAgeAudioProcessor::updateLatency()
+{
+    const auto& oversampler = *oversamplers[static_cast<size_t>(activeOversampler)];
+    float oversamplerLatency = oversampler.getLatencyInSamples();
+    float delayLineLatency = getBaseDelaySamples();  // Wow/flutter base delay for the active mode
+
+    // ADAA averaging delay, at the oversampled rate (fractional; the dry path takes it exactly)
+    float saturatorLatency = static_cast<float>(TapeSaturator::getLatencySamples(saturationMode)
+                                                / static_cast<double>(oversampler.getOversamplingFactor()));
+    float totalWetLatency = oversamplerLatency + delayLineLatency + saturatorLatency;
+
+    dryWetMixer.setWetLatency(totalWetLatency);
+    setLatencySamples(juce::roundToInt(totalWetLatency));
 }
 
 void TapeAgeAudioProcessor::releaseResources()
 {
     // Phase 4.1: Reset DSP components
-    oversampler.reset();
+    for (auto& stage : oversamplers)
+        if (stage != nullptr)
+            stage->reset();
 
     // Phase 4.2: Reset wow/flutter modulation
     delayLine.reset();
@@ -132,6 +255,7 @@ void TapeAgeAudioProcessor::releaseResources()
 void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    pfs::TraceScope blockTrace("TapeAge::processBlock", buffer.getNumSamples());
     juce::ignoreUnused(midiMessages);
 
     // Clear unused channels
@@ -148,6 +272,29 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         buffer.applyGain(inputGain);
     }
 
+    // Phase 4.1: Follow the oversampling quality (and offline render upgrade), the
+    // wow/flutter mode and the ADAA order. Every engine was built in prepareToPlay;
+    // switching only resets and re-reports latency.
+    const int oversamplerIndex = getOversamplerIndex();
+    const bool lowLatency = parameters.getRawParameterValue("modulation_mode")->load() >= 0.5f;
+    const auto adaaMode = getSaturationModeParameter();
+
+    if (oversamplerIndex != activeOversampler || lowLatency != lowLatencyModulation || adaaMode != saturationMode)
+    {
+        if (oversamplerIndex != activeOversampler)
+        {
+            activeOversampler = oversamplerIndex;
+            oversamplers[static_cast<size_t>(activeOversampler)]->reset();
+            saturator.reset();  // ADAA history belongs to the previous rate
+        }
+
+        lowLatencyModulation = lowLatency;
+        saturationMode = adaaMode;
+        updateLatency();
+    }
+
+    auto& oversampler = *oversamplers[static_cast<size_t>(activeOversampler)];
+
     // Phase 4.4: Store dry signal AFTER input gain
     juce::dsp::AudioBlock<float> block(buffer);
     dryWetMixer.pushDrySamples(block);
@@ -160,8 +307,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Phase 4.1: Core Saturation Processing
     // Processing chain:
     // 1. Read drive parameter and calculate gain
-    // 2. Upsample 2x
-    // 3. Apply tanh saturation manually (drive controls gain scaling)
+    // 2. Upsample (Off / 2x / 4x / 8x)
+    // 3. Apply ADAA tanh saturation (drive controls gain scaling)
     // 4. Downsample
 
     // Read drive parameter (0.0 to 1.0)
@@ -192,20 +339,22 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // Upsample
     auto oversampledBlock = oversampler.processSamplesUp(block);
 
-    // Apply tanh saturation manually in oversampled domain
+    // Apply tanh saturation in oversampled domain (ADAA keeps 1x/2x clean at high drive)
     // Calculate makeup gain to compensate for volume increase (v1.1.0)
     // Simple empirical formula: reduce output level proportionally to gain
     // This keeps perceived loudness roughly constant
     float makeupGain = 1.0f / std::sqrt(gain);
 
-    for (size_t channel = 0; channel < oversampledBlock.getNumChannels(); ++channel)
-    {
-        auto* channelData = oversampledBlock.getChannelPointer(channel);
-        for (size_t sample = 0; sample < oversampledBlock.getNumSamples(); ++sample)
-        {
-            channelData[sample] = std::tanh(gain * channelData[sample]) * makeupGain;
-        }
-    }
+    float hysteresis = parameters.getRawParameterValue("hysteresis")->load() * 0.7f;  // Memory term h (loop gain < 0.7)
+
+    float* oversampledChannels[TapeSaturator::maxChannels] = {};
+    const int numOversampledChannels = juce::jmin(TapeSaturator::maxChannels, static_cast<int>(oversampledBlock.getNumChannels()));
+
+    for (int channel = 0; channel < numOversampledChannels; ++channel)
+        oversampledChannels[channel] = oversampledBlock.getChannelPointer(static_cast<size_t>(channel));
+
+    saturator.process(oversampledChannels, numOversampledChannels, static_cast<int>(oversampledBlock.getNumSamples()),
+                      saturationMode, gain, hysteresis, makeupGain);
 
     // Downsample back to original sample rate
     oversampler.processSamplesDown(block);
@@ -233,6 +382,12 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const float flutterPhaseIncrement = (flutterFrequency * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
     const float flutterDepthRatio = 0.2f;  // 20% of wow depth
 
+    // Modulation swing is scaled by 100ms in both modes (same pitch deviation).
+    // Low latency offsets it by its peak so the delay never drops below the base.
+    const float baseDelaySamples = getBaseDelaySamples();
+    const float wowRangeSamples = static_cast<float>(currentSampleRate) * 0.1f;
+    const float modulationOffset = lowLatencyModulation ? 1.0f + flutterDepthRatio : 0.0f;
+
     // Process each channel
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
@@ -251,9 +406,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             float combinedModulation = lfoValue + (flutterValue * flutterDepthRatio);
 
             // Calculate delay time in samples
-            // Base delay at center of buffer (100ms) + combined modulation
-            float baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
-            float modulationSamples = combinedModulation * modulationDepth * baseDelaySamples;
+            // Base delay (100ms centre or 2ms floor) + combined modulation
+            float modulationSamples = (combinedModulation + modulationOffset) * modulationDepth * wowRangeSamples;
             float totalDelay = baseDelaySamples + modulationSamples;
 
             // Push input sample to delay line
@@ -309,12 +463,12 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         // At age=1.0, probability = 0.02 (2% per 100ms check = ~20% per second = 5-10 second intervals)
         float dropoutProbability = age * 0.02f;
 
-        if (random.nextFloat() < dropoutProbability && !inDropout)
+        if (random.nextUniform() < dropoutProbability && !inDropout)
         {
             // Start dropout event
             inDropout = true;
             // Random duration: 50-150ms (architecture.md line 39)
-            float dropoutDurationMs = 50.0f + random.nextFloat() * 100.0f;
+            float dropoutDurationMs = 50.0f + random.nextUniform() * 100.0f;
             dropoutSamplesRemaining = static_cast<int>(currentSampleRate * dropoutDurationMs / 1000.0f);
         }
     }
@@ -323,7 +477,7 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     if (inDropout && dropoutSamplesRemaining > 0)
     {
         // Random attenuation factor 0.1-0.3 (70-90% reduction) (architecture.md line 40)
-        const float dropoutTargetGain = 0.1f + random.nextFloat() * 0.2f;
+        const float dropoutTargetGain = 0.1f + random.nextUniform() * 0.2f;
 
         // Envelope attack/release time: 5-10ms (architecture.md line 118)
         const float envelopeTimeMs = 7.5f;  // Mid-range
@@ -391,27 +545,34 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // age = 1.0 → noiseGain = 0.001 (-60dB, was -80dB)
     float noiseGain = age * 0.001f;  // Maximum -60dB at full age (subtle but more present)
 
-    if (noiseGain > 0.0f)
+    if (noiseGain > 0.0f && ! noiseBuffer.empty())
     {
         // One-pole lowpass filter coefficient for ~8kHz cutoff (architecture.md line 125)
         // Formula: coeff = 1 - exp(-2π * cutoffFreq / sampleRate)
         const float cutoffFreq = 8000.0f;
         const float filterCoeff = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * cutoffFreq / static_cast<float>(currentSampleRate));
 
+        const int noiseBlockSize = static_cast<int>(noiseBuffer.size());
+
         for (int channel = 0; channel < numChannels; ++channel)
         {
             auto* channelData = buffer.getWritePointer(channel);
 
-            for (int sample = 0; sample < numSamples; ++sample)
+            for (int start = 0; start < numSamples; start += noiseBlockSize)
             {
-                // Generate white noise: range [-1.0, 1.0]
-                float whiteNoise = random.nextFloat() * 2.0f - 1.0f;
+                const int count = juce::jmin(noiseBlockSize, numSamples - start);
 
-                // Apply one-pole lowpass filter (simulates tape frequency response)
-                noiseFilterState[channel] += filterCoeff * (whiteNoise - noiseFilterState[channel]);
+                // Generate white noise for the whole chunk: range [-1.0, 1.0]
+                random.fillBipolar(noiseBuffer.data(), count);
 
-                // Add filtered noise at very low amplitude
-                channelData[sample] += noiseFilterState[channel] * noiseGain;
+                for (int sample = 0; sample < count; ++sample)
+                {
+                    // Apply one-pole lowpass filter (simulates tape frequency response)
+                    noiseFilterState[channel] += filterCoeff * (noiseBuffer[static_cast<size_t>(sample)] - noiseFilterState[channel]);
+
+                    // Add filtered noise at very low amplitude
+                    channelData[start + sample] += noiseFilterState[channel] * noiseGain;
+                }
             }
         }
     }
@@ -430,19 +591,8 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         buffer.applyGain(outputGain);
     }
 
-    // Phase 5.2: Calculate peak level for VU meter (AFTER output gain)
-    float peakLevel = 0.0f;
-    for (int channel = 0; channel < numChannels; ++channel)
-    {
-        float channelPeak = buffer.getMagnitude(channel, 0, numSamples);
-        peakLevel = std::max(peakLevel, channelPeak);
-    }
-
-    // Convert to dB and store atomically (clamp to -100dB minimum to avoid log(0))
-    float peakDb = peakLevel > 0.00001f
-        ? juce::Decibels::gainToDecibels(peakLevel)
-        : -100.0f;
-    outputLevel.store(peakDb, std::memory_order_relaxed);
+    // Phase 5.2: Meter the output (AFTER output gain)
+    outputMeter.process(buffer);
 }
 
 juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
@@ -452,9 +602,7 @@ juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
 
 void TapeAgeAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    // Debug logging
-    juce::File("/tmp/tapeage_debug.log").appendText(
-        juce::Time::getCurrentTime().toString(true, true) + " - getStateInformation called\n");
+    pfs::Trace::message("TapeAge", "getStateInformation called");
 
     auto state = parameters.copyState();
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
@@ -463,10 +611,7 @@ void TapeAgeAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 
 void TapeAgeAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    // Debug logging
-    juce::File debugLog("/tmp/tapeage_debug.log");
-    debugLog.appendText(
-        juce::Time::getCurrentTime().toString(true, true) + " - setStateInformation called\n");
+    pfs::Trace::message("TapeAge", "setStateInformation called");
 
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
@@ -474,15 +619,21 @@ void TapeAgeAudioProcessor::setStateInformation(const void* data, int sizeInByte
     {
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 
+        // Sessions saved before the seed existed keep this instance's fresh seed
+        if (parameters.state.hasProperty("noiseSeed"))
+            noiseSeed = static_cast<juce::int64>(parameters.state.getProperty("noiseSeed"));
+        else
+            parameters.state.setProperty("noiseSeed", noiseSeed.load(), nullptr);
+
         // Log parameter values after restoration
         auto* driveParam = parameters.getRawParameterValue("drive");
         auto* ageParam = parameters.getRawParameterValue("age");
         auto* mixParam = parameters.getRawParameterValue("mix");
 
-        debugLog.appendText(
-            "  Parameters after restore - Drive: " + juce::String(driveParam->load()) +
+        pfs::Trace::message("TapeAge",
+            "Parameters after restore - Drive: " + juce::String(driveParam->load()) +
             ", Age: " + juce::String(ageParam->load()) +
-            ", Mix: " + juce::String(mixParam->load()) + "\n");
+            ", Mix: " + juce::String(mixParam->load()));
     }
 }
 
@@ -1,6 +1,12 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <memory>
+#include "LevelMeter.h"
+#include "NoiseSource.h"
+#include "TapeSaturator.h"
+#include "Trace.h"
 
 class TapeAgeAudioProcessor : public juce::AudioProcessor
 {
@@ -34,21 +40,32 @@ public:
     juce::AudioProcessorValueTreeState parameters;
 
     // Phase 5.2: Output Level Metering (public for PluginEditor access)
-    std::atomic<float> outputLevel { -100.0f };  // Peak level in dB (initialized to silence)
+    pfs::LevelMeter outputMeter;  // Peak, true peak, RMS, loudness; the editor reads its history
 
 private:
     // DSP Components (declared BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec currentSpec;
 
     // Phase 4.1: Core Saturation Processing
-    juce::dsp::Oversampling<float> oversampler { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple };
+    // One engine per quality: index = filter (0 IIR, 1 FIR) * numOversamplingFactors + factor (0 = off .. 3 = 8x)
+    static constexpr int numOversamplingFactors = 4;
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, 2 * numOversamplingFactors> oversamplers;
+    int activeOversampler { 0 };
+    int getOversamplerIndex() const;  // From the quality parameters and isNonRealtime()
+    void updateLatency();             // Dry path delay + host latency for the active engine
+    TapeSaturator saturator;          // ADAA tanh + hysteresis, runs at the oversampled rate
+    TapeSaturator::Mode saturationMode { TapeSaturator::Mode::FirstOrder };  // saturation_aa in effect (latency reported for it)
+    TapeSaturator::Mode getSaturationModeParameter() const;
 
     // Phase 4.2: Wow/Flutter Modulation
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayLine;
     float lfoPhase[2] { 0.0f, 0.0f };  // Separate phase per channel for stereo width
     float flutterPhase[2] { 0.0f, 0.0f };  // Secondary flutter LFO phase per channel (v1.1.0)
-    juce::Random random;
+    pfs::NoiseSource random;  // LFO phases, dropouts and hiss (seeded from noiseSeed in prepareToPlay)
+    std::atomic<juce::int64> noiseSeed { 0 };  // Per-instance, saved with the state for reproducible renders
     double currentSampleRate { 44100.0 };
+    bool lowLatencyModulation { false };  // modulation_mode in effect (latency reported for it)
+    float getBaseDelaySamples() const;
 
     // Phase 4.3: Degradation Features (Dropout + Noise + High-frequency Rolloff)
     int dropoutCountdown { 0 };  // Samples until next dropout check
@@ -56,10 +73,14 @@ private:
     int dropoutSamplesRemaining { 0 };  // Current dropout duration
     float dropoutEnvelope { 1.0f };  // Smooth attack/release (1.0 = no attenuation)
     float noiseFilterState[2] { 0.0f, 0.0f };  // One-pole lowpass filter state per channel
+    std::vector<float> noiseBuffer;  // Block of white noise (sized in prepareToPlay)
     juce::dsp::IIR::Filter<float> ageFilter[2];  // High-frequency rolloff per channel (v1.1.0)
 
     // Phase 4.4: Dry/Wet Mixing
-    juce::dsp::DryWetMixer<float> dryWetMixer { 20000 };  // Max latency: 192kHz * 0.1s delay line + oversampler
+    juce::dsp::DryWetMixer<float> dryWetMixer { 20000 };  // Max latency: 192kHz * 0.1s delay line + 8x FIR oversampler
+
+    // Diagnostics: shared trace writer thread (log/profile output, see pfs::Trace)
+    juce::SharedResourcePointer<pfs::TraceWriter> traceWriter;
 
     // Parameter layout creation
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -0,0 +1,157 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cmath>
+
+// Antiderivative anti-aliased tanh tape saturator.
+//
+// Rather than sampling tanh(u) directly, each output is the mean of tanh over
+// the segment between consecutive inputs, taken from closed-form antiderivatives:
+//   1st order: (F1(u[n]) - F1(u[n-1])) / (u[n] - u[n-1]),  F1 = log cosh
+//   2nd order: second divided difference of F2 = integral of log cosh (dilogarithm,
+//              evaluated as a fixed-degree polynomial in log(1 + e^-2|u|))
+// Harmonics above Nyquist are attenuated before they fold back, so 1x/2x
+// oversampling stays clean at high drive. Cost: half a sample (1st order) or one
+// sample (2nd order) of delay at the processing rate. Near-equal inputs fall back
+// to midpoint evaluation instead of the ill-conditioned divisions.
+//
+// The optional memory term feeds the previous output back into the drive,
+// u = g (1 + h) x - h y[n-1], so rising and falling signals trace different
+// transfer curves (a cheap hysteresis stand-in). The loop gain stays below h,
+// so it is stable, and the small-signal gain stays g.
+//
+// State is double precision (the divided differences need it); channels are
+// processed in lockstep per sample.
+class TapeSaturator
+{
+public:
+    enum class Mode { Direct, FirstOrder, SecondOrder };  // Parameter-choice order
+
+    static constexpr int maxChannels = 2;
+
+    // Group delay of the averaging, in samples at the processing rate
+    static constexpr double getLatencySamples(Mode mode)
+    {
+        return mode == Mode::SecondOrder ? 1.0 : mode == Mode::FirstOrder ? 0.5 : 0.0;
+    }
+
+    void reset()
+    {
+        state.fill({});
+    }
+
+    // In place: x = makeup * sat(drive (1 + h) x - h y[n-1])
+    void process(float* const* channels, int numChannels, int numSamples, Mode mode,
+                 float drive, float hysteresis, float makeupGain)
+    {
+        numChannels = juce::jmin(numChannels, maxChannels);
+
+        switch (mode)
+        {
+            case Mode::Direct:      processImpl<Mode::Direct>     (channels, numChannels, numSamples, drive, hysteresis, makeupGain); break;
+            case Mode::SecondOrder: processImpl<Mode::SecondOrder>(channels, numChannels, numSamples, drive, hysteresis, makeupGain); break;
+            case Mode::FirstOrder:
+            default:                processImpl<Mode::FirstOrder> (channels, numChannels, numSamples, drive, hysteresis, makeupGain); break;
+        }
+    }
+
+private:
+    struct ChannelState
+    {
+        double u1 = 0.0, u2 = 0.0;  // Previous two nonlinearity inputs
+        double f1 = 0.0;            // F1(u1) (1st order)
+        double f2 = 0.0;            // F2(u1) (2nd order)
+        double d1 = 0.0;            // Previous first divided difference of F2 (2nd order)
+        double y1 = 0.0;            // Previous output (memory term)
+    };
+
+    template <Mode M>
+    void processImpl(float* const* channels, int numChannels, int numSamples,
+                     float drive, float hysteresis, float makeupGain)
+    {
+        const double h = hysteresis;
+        const double inputGain = static_cast<double>(drive) * (1.0 + h);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& s = state[static_cast<size_t>(ch)];
+                const double u = inputGain * channels[ch][i] - h * s.y1;
+                double y;
+
+                if constexpr (M == Mode::Direct)
+                {
+                    y = std::tanh(u);
+                }
+                else if constexpr (M == Mode::FirstOrder)
+                {
+                    const double f1 = logCosh(u);
+                    const double du = u - s.u1;
+                    y = std::abs(du) < firstOrderTolerance ? std::tanh(0.5 * (u + s.u1)) : (f1 - s.f1) / du;
+                    s.f1 = f1;
+                }
+                else
+                {
+                    const double f2 = logCoshIntegral(u);
+                    const double du = u - s.u1;
+                    const double d1 = std::abs(du) < secondOrderTolerance ? logCosh(0.5 * (u + s.u1)) : (f2 - s.f2) / du;
+
+                    if (std::abs(u - s.u2) < secondOrderTolerance)
+                    {
+                        const double mid = 0.5 * (u + s.u2);
+                        const double delta = mid - s.u1;
+                        y = std::abs(delta) < secondOrderTolerance
+                                ? std::tanh(0.5 * (mid + s.u1))
+                                : (2.0 / delta) * (logCosh(mid) + (s.f2 - logCoshIntegral(mid)) / delta);
+                    }
+                    else
+                    {
+                        y = 2.0 * (d1 - s.d1) / (u - s.u2);
+                    }
+
+                    s.f2 = f2;
+                    s.d1 = d1;
+                }
+
+                s.u2 = s.u1;
+                s.u1 = u;
+                s.y1 = y;
+                channels[ch][i] = static_cast<float>(y) * makeupGain;
+            }
+        }
+    }
+
+    // F1(x) = log cosh x, stable for large |x|
+    static double logCosh(double x)
+    {
+        const double a = std::abs(x);
+        return a + std::log1p(std::exp(-2.0 * a)) - ln2;
+    }
+
+    // F2(x) = integral 0..x of log cosh t (odd):
+    // a^2/2 - a ln2 + pi^2/24 + Li2(-e^(-2a)) / 2, a = |x|
+    //
+    // With L = log(1 + e^(-2a)) in [0, ln2], the Bernoulli-number series
+    //   Li2(-z) = -L - L^2/4 - sum B_2k L^(2k+1) / (2k+1)!
+    // converges as (L / 2pi)^2k, so seven fixed terms reach double precision:
+    // one exp, one log1p and a Horner polynomial, no data-dependent loop.
+    static double logCoshIntegral(double x)
+    {
+        constexpr double pi = juce::MathConstants<double>::pi;
+        const double a = std::abs(x);
+        const double L = std::log1p(std::exp(-2.0 * a));
+        const double t = L * L;
+        const double p = 1.0 / 36.0 + t * (-1.0 / 3600.0 + t * (1.0 / 211680.0 + t * (-1.0 / 10886400.0
+                       + t * (1.0 / 526901760.0 + t * (-4.064761645144226e-11 + t * 8.921691020456452e-13)))));
+        const double dilog = -L * (1.0 + 0.25 * L + t * p);
+        const double g = 0.5 * a * a - a * ln2 + pi * pi / 24.0 + 0.5 * dilog;
+        return x < 0.0 ? -g : g;
+    }
+
+    static constexpr double ln2 = 0.69314718055994530942;
+    static constexpr double firstOrderTolerance = 1.0e-5;
+    static constexpr double secondOrderTolerance = 1.0e-3;  // F2 is large; keep the 2nd difference well conditioned
+
+    std::array<ChannelState, maxChannels> state {};
+};
@@ -0,0 +1,167 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace pfs
+{
+
+// Alias-suppressed tanh drive for the reverb plugins: out = makeup * tanh(gain * in).
+//
+// Three qualities, all with the nonlinearity inlined (no std::function):
+//   Adaa           1x, first-order antiderivative anti-aliasing: each output is
+//                  the mean of tanh between consecutive inputs,
+//                  (logcosh(u[n]) - logcosh(u[n-1])) / (u[n] - u[n-1]). No
+//                  filter latency (half a sample of group delay). Double state,
+//                  as the divided difference needs it. Lowers aliasing by
+//                  ~5-6 dB against plain tanh at high gain - the zero-latency
+//                  option, not the cheap one (it costs about as much as a
+//                  std::tanh per sample).
+//   Oversampled2x  polyphase IIR half-band oversampling around a Pade tanh
+//   Oversampled4x  (juce::dsp::FastMathApproximations, clamped to +-5 where it
+//                  is within 1e-4 of tanh). The kernel is branch-free and runs
+//                  over contiguous samples, so the compiler vectorises it.
+//
+// Both oversamplers are built in prepare(), so switching quality on the audio
+// thread never allocates; getLatencySamples() is the integer latency of the
+// active quality for setLatencySamples()/DryWetMixer.
+class DriveStage
+{
+public:
+    enum class Quality { Adaa, Oversampled2x, Oversampled4x };  // Parameter-choice order
+
+    // Message thread, audio stopped (allocates)
+    void prepare(const juce::dsp::ProcessSpec& spec)
+    {
+        const auto numChannels = juce::jmax(1u, spec.numChannels);
+
+        for (size_t factor = 0; factor < oversamplers.size(); ++factor)
+        {
+            // Integer latency so the reported PDC is exact
+            auto& stage = oversamplers[factor];
+            stage = std::make_unique<juce::dsp::Oversampling<float>>(numChannels, factor + 1,
+                                                                     juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR,
+                                                                     true, true);
+            stage->initProcessing(static_cast<size_t>(spec.maximumBlockSize));
+        }
+
+        adaaState.assign(numChannels, {});
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& stage : oversamplers)
+            if (stage != nullptr)
+                stage->reset();
+
+        std::fill(adaaState.begin(), adaaState.end(), AdaaState {});
+    }
+
+    // Audio thread. The incoming path starts from a clean state.
+    void setQuality(Quality newQuality)
+    {
+        if (newQuality == quality)
+            return;
+
+        quality = newQuality;
+        reset();
+    }
+
+    Quality getQuality() const { return quality; }
+
+    int getLatencySamples() const
+    {
+        if (quality == Quality::Adaa || oversamplers[0] == nullptr)
+            return 0;
+
+        return juce::roundToInt(getOversampler().getLatencyInSamples());
+    }
+
+    // Audio thread, in place
+    void process(juce::dsp::AudioBlock<float>& block, float gain, float makeupGain = 1.0f)
+    {
+        if (quality == Quality::Adaa)
+        {
+            const auto numChannels = juce::jmin(block.getNumChannels(), adaaState.size());
+
+            for (size_t ch = 0; ch < numChannels; ++ch)
+                processAdaa(block.getChannelPointer(ch), static_cast<int>(block.getNumSamples()), adaaState[ch], gain, makeupGain);
+
+            return;
+        }
+
+        auto& oversampler = getOversampler();
+        auto oversampledBlock = oversampler.processSamplesUp(block);
+
+        for (size_t ch = 0; ch < oversampledBlock.getNumChannels(); ++ch)
+            processPade(oversampledBlock.getChannelPointer(ch), static_cast<int>(oversampledBlock.getNumSamples()), gain, makeupGain);
+
+        oversampler.processSamplesDown(block);
+    }
+
+    // Audio thread, in place: the curve switched off but the latency kept, so
+    // a stage that is sometimes skipped does not move the signal in time
+    void processBypassed(juce::dsp::AudioBlock<float>& block)
+    {
+        if (quality == Quality::Adaa)
+            return;
+
+        auto& oversampler = getOversampler();
+        oversampler.processSamplesUp(block);
+        oversampler.processSamplesDown(block);
+    }
+
+private:
+    struct AdaaState
+    {
+        double u1 = 0.0;  // Previous input (after gain)
+        double f1 = 0.0;  // logcosh(u1)
+    };
+
+    juce::dsp::Oversampling<float>& getOversampler() const
+    {
+        return *oversamplers[quality == Quality::Oversampled4x ? 1 : 0];
+    }
+
+    static void processPade(float* samples, int numSamples, float gain, float makeupGain)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float u = juce::jlimit(-5.0f, 5.0f, gain * samples[i]);
+            samples[i] = makeupGain * juce::dsp::FastMathApproximations::tanh(u);
+        }
+    }
+
+    static void processAdaa(float* samples, int numSamples, AdaaState& state, float gain, float makeupGain)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double u = static_cast<double>(gain) * samples[i];
+            const double f = logCosh(u);
+            const double du = u - state.u1;
+            const double y = std::abs(du) < tolerance ? std::tanh(0.5 * (u + state.u1)) : (f - state.f1) / du;
+
+            state.u1 = u;
+            state.f1 = f;
+            samples[i] = makeupGain * static_cast<float>(y);
+        }
+    }
+
+    // log cosh x, stable for large |x|
+    static double logCosh(double x)
+    {
+        const double a = std::abs(x);
+        return a + std::log1p(std::exp(-2.0 * a)) - 0.69314718055994530942;
+    }
+
+    static constexpr double tolerance = 1.0e-5;
+
+    Quality quality = Quality::Adaa;
+    std::array<std::unique_ptr<juce::dsp::Oversampling<float>>, 2> oversamplers;  // 2x, 4x
+    std::vector<AdaaState> adaaState;
+};
+
+} // namespace pfs
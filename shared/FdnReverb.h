@@ -0,0 +1,416 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace pfs
+{
+
+// Feedback-delay-network reverb (replaces juce::dsp::Reverb / Freeverb).
+//
+// NumLines (8 or 16) delay lines are mixed through a scaled Walsh-Hadamard
+// matrix, which is orthogonal and therefore lossless: all decay comes from the
+// per-line damping filters. Each line's filter is a one-pole low-pass whose DC
+// and Nyquist gains are set from the line's length, so every line loses
+// exactly 60 dB after the low-frequency RT60 (setDecaySeconds) and after the
+// shorter high-frequency RT60 (setDamping) - the decay is calibrated in real
+// seconds, independent of size.
+//
+// Processing runs in chunks no longer than the shortest delay, so a whole
+// chunk of taps can be read before anything is written back. Per sample the
+// work is then fixed NumLines-wide loops (filter, Hadamard butterflies, input
+// injection) that the compiler turns into SIMD. Half of the read taps are
+// slowly modulated (one sine LFO per line) to break up metallic modes - the
+// mixing spreads that to every line. The LFO is stepped once per chunk: while
+// a tap moves less than maxStepPerChunk samples per chunk it holds one
+// fractional delay for the whole chunk, and only faster moves (size glides)
+// ramp the delay per sample. Taps that are not moving read whole samples.
+//
+// Stereo in, stereo out, wet only. prepare() allocates; everything else is
+// real-time safe.
+template <int NumLines>
+class FdnReverb
+{
+public:
+    static_assert(NumLines == 8 || NumLines == 16, "FdnReverb supports 8 or 16 lines");
+
+    static constexpr int numLines = NumLines;
+    static constexpr int chunkSize = 32;
+
+    // Allocates (message thread / prepareToPlay only)
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+
+        capacity = juce::nextPowerOfTwo(static_cast<int>(getMaxDelaySeconds() * sampleRate) + chunkSize + 4);
+        mask = capacity - 1;
+        lines.assign(static_cast<size_t>(capacity * numLines), 0.0f);
+
+        // Detuned LFO rates (0.1 - 0.9 Hz) so no two lines move together
+        for (int i = 0; i < numLines; ++i)
+        {
+            const double rate = 0.1 + 0.8 * static_cast<double>((i * 5) % numLines) / numLines;
+            lfoIncrement[i] = static_cast<float>(juce::MathConstants<double>::twoPi * rate / sampleRate);
+        }
+
+        for (int i = 0; i < numLines; ++i)
+            inputSign[i] = hadamardSign(3, i);
+
+        updateTargets();
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(lines.begin(), lines.end(), 0.0f);
+        writeIndex = 0;
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            filterState[i] = 0.0f;
+            lfoPhase[i] = juce::MathConstants<float>::twoPi * static_cast<float>(i) / numLines;
+            lineDelay[i] = targetDelay[i];
+            tapDelay[i] = lineDelay[i];
+        }
+    }
+
+    // Longest round trip through any line (largest size, full modulation) -
+    // add this to the RT60-based decay when reporting tail length
+    static double getMaxDelaySeconds()
+    {
+        double longestMs = 0.0;
+
+        for (int i = 0; i < numLines; ++i)
+            longestMs = juce::jmax(longestMs, getLineLengthMs(i));
+
+        return (longestMs * maxSizeScale + maxModulationMs) * 0.001;
+    }
+
+    // Low-frequency RT60 in seconds
+    void setDecaySeconds(float seconds)
+    {
+        seconds = juce::jlimit(0.05f, 60.0f, seconds);
+
+        if (seconds != decaySeconds)
+        {
+            decaySeconds = seconds;
+            coefficientsDirty = true;
+        }
+    }
+
+    // 0 = bright (HF decays as long as LF), 1 = dark (HF RT60 = 10% of the decay)
+    void setDamping(float newDamping)
+    {
+        newDamping = juce::jlimit(0.0f, 1.0f, newDamping);
+
+        if (newDamping != damping)
+        {
+            damping = newDamping;
+            coefficientsDirty = true;
+        }
+    }
+
+    // 0-1: scales every line length 0.25x - 1.5x (glides, no clicks)
+    void setSize(float newSize)
+    {
+        newSize = juce::jlimit(0.0f, 1.0f, newSize);
+
+        if (newSize != size)
+        {
+            size = newSize;
+            coefficientsDirty = true;
+        }
+    }
+
+    // 0-1: tap modulation depth, up to maxModulationMs
+    void setModulation(float amount)
+    {
+        modulationDepth = juce::jlimit(0.0f, 1.0f, amount) * static_cast<float>(maxModulationMs * 0.001 * sampleRate);
+    }
+
+    // Wet output. inRight may equal inLeft (mono in); outRight may be null (mono
+    // out, left only). In-place use (out == in) is fine.
+    void process(const float* inLeft, const float* inRight, float* outLeft, float* outRight, int numSamples)
+    {
+        if (coefficientsDirty)
+            updateTargets();
+
+        for (int offset = 0; offset < numSamples; offset += chunkSize)
+        {
+            const int count = juce::jmin(chunkSize, numSamples - offset);
+            processChunk(inLeft + offset, inRight + offset,
+                         outLeft + offset, outRight != nullptr ? outRight + offset : nullptr, count);
+        }
+    }
+
+private:
+    void processChunk(const float* inLeft, const float* inRight, float* outLeft, float* outRight, int n)
+    {
+        alignas(32) float taps[numLines][chunkSize];  // Line-major: every stage below runs along time
+
+        // Phase 1: read every line's tap for the whole chunk. Odd lines are
+        // modulated; the LFO moves a tap far less than a sample per chunk, so it
+        // is stepped once per chunk. Lines gliding to a new size ramp per sample.
+        const float glide = 1.0f - std::exp(-static_cast<float>(n) / (0.05f * static_cast<float>(sampleRate)));
+        const float minDelay = static_cast<float>(minimumDelay);
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            lineDelay[i] += (targetDelay[i] - lineDelay[i]) * glide;
+            if (std::abs(targetDelay[i] - lineDelay[i]) < 0.01f)
+                lineDelay[i] = targetDelay[i];
+
+            float end = lineDelay[i];
+
+            if ((i & 1) != 0 && modulationDepth > 0.0f)
+            {
+                lfoPhase[i] += lfoIncrement[i] * static_cast<float>(n);
+                if (lfoPhase[i] >= juce::MathConstants<float>::twoPi)
+                    lfoPhase[i] -= juce::MathConstants<float>::twoPi;
+
+                end = juce::jmax(minDelay, end + modulationDepth * std::sin(lfoPhase[i]));
+            }
+
+            const float start = tapDelay[i];
+            tapDelay[i] = end;
+
+            const float* line = lines.data() + i * capacity;
+
+            if (std::abs(end - start) < maxStepPerChunk)
+            {
+                // Still or slowly modulated tap: hold this chunk's delay, so the
+                // interpolation is a fixed 4-tap FIR over contiguous samples
+                const int whole = static_cast<int>(end);
+                const float frac = end - static_cast<float>(whole);
+                const int base = writeIndex - whole;
+
+                if (frac == 0.0f)
+                {
+                    for (int t = 0; t < n; ++t)
+                        taps[i][t] = line[(base + t) & mask];
+                }
+                else
+                {
+                    const float f2 = frac * frac, f3 = f2 * frac;
+                    const float wm1 = -0.5f * frac + f2 - 0.5f * f3;
+                    const float w0  = 1.0f - 2.5f * f2 + 1.5f * f3;
+                    const float w1  = 0.5f * frac + 2.0f * f2 - 1.5f * f3;
+                    const float w2  = -0.5f * f2 + 0.5f * f3;
+
+                    if (base - 2 >= 0 && base + n < capacity)
+                    {
+                        const float* x = line + base;
+
+                        for (int t = 0; t < n; ++t)
+                            taps[i][t] = wm1 * x[t + 1] + w0 * x[t] + w1 * x[t - 1] + w2 * x[t - 2];
+                    }
+                    else
+                    {
+                        for (int t = 0; t < n; ++t)
+                        {
+                            const int index = base + t;
+                            taps[i][t] = wm1 * line[(index + 1) & mask] + w0 * line[index & mask]
+                                       + w1 * line[(index - 1) & mask] + w2 * line[(index - 2) & mask];
+                        }
+                    }
+                }
+
+                continue;
+            }
+
+            // Gliding to a new size: ramp the delay per sample
+            const float step = (end - start) / static_cast<float>(n);
+
+            for (int t = 0; t < n; ++t)
+            {
+                const float delay = start + step * static_cast<float>(t + 1);
+                const int whole = static_cast<int>(delay);
+                const float frac = delay - static_cast<float>(whole);
+                const int index = writeIndex + t - whole;
+
+                // 4-point Catmull-Rom (linear interpolation would low-pass the
+                // loop on every pass and shorten the HF decay)
+                const float ym1 = line[(index + 1) & mask];
+                const float y0  = line[index & mask];
+                const float y1  = line[(index - 1) & mask];
+                const float y2  = line[(index - 2) & mask];
+
+                const float c1 = 0.5f * (y1 - ym1);
+                const float c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+                const float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+                taps[i][t] = ((c3 * frac + c2) * frac + c1) * frac + y0;
+            }
+        }
+
+        // Phase 2: damping. The one-pole recursion runs along time, so lines are
+        // stepped together (one SIMD lane per line).
+        alignas(32) float state[numLines];
+
+        for (int i = 0; i < numLines; ++i)
+            state[i] = filterState[i];
+
+        for (int t = 0; t < n; ++t)
+            for (int i = 0; i < numLines; ++i)
+                taps[i][t] = state[i] = damperGain[i] * taps[i][t] + damperPole[i] * state[i];
+
+        for (int i = 0; i < numLines; ++i)
+            filterState[i] = state[i];
+
+        // Phase 3: Hadamard mix. No recursion inside a chunk, so each butterfly
+        // is a plain add/sub over the chunk.
+        hadamard(taps, n);
+
+        // Rows 1 and 2 of the mix are the two (orthogonal, so decorrelated)
+        // output taps - the transform computes them for free. Outputs are taken
+        // before injection so in-place processing can overwrite the input.
+        alignas(32) float dryLeft[chunkSize], dryRight[chunkSize];
+
+        for (int t = 0; t < n; ++t)
+        {
+            dryLeft[t] = inLeft[t] * inputGain;
+            dryRight[t] = inRight[t] * inputGain;
+        }
+
+        for (int t = 0; t < n; ++t)
+            outLeft[t] = taps[1][t] * outputGain;
+
+        if (outRight != nullptr)
+            for (int t = 0; t < n; ++t)
+                outRight[t] = taps[2][t] * outputGain;
+
+        // Phase 4: inject the input (even lines left, odd lines right) and write back
+        for (int i = 0; i < numLines; ++i)
+        {
+            const float* dry = (i & 1) != 0 ? dryRight : dryLeft;
+            const float sign = inputSign[i];
+            float* y = taps[i];
+
+            for (int t = 0; t < n; ++t)
+                y[t] += sign * dry[t];
+
+            float* line = lines.data() + i * capacity;
+            const int first = juce::jmin(n, capacity - writeIndex);
+
+            std::copy(y, y + first, line + writeIndex);
+            std::copy(y + first, y + n, line);
+        }
+
+        writeIndex = (writeIndex + n) & mask;
+    }
+
+    // In-place fast Walsh-Hadamard transform across lines, scaled to be
+    // orthonormal, applied to n samples of each line
+    static void hadamard(float (&x)[numLines][chunkSize], int n)
+    {
+        for (int half = 1; half < numLines; half *= 2)
+            for (int i = 0; i < numLines; i += 2 * half)
+                for (int j = i; j < i + half; ++j)
+                {
+                    float* a = x[j];
+                    float* b = x[j + half];
+
+                    for (int t = 0; t < n; ++t)
+                    {
+                        const float sum = a[t] + b[t];
+                        b[t] = a[t] - b[t];
+                        a[t] = sum;
+                    }
+                }
+
+        const float scale = numLines == 16 ? 0.25f : 0.35355339f;  // 1 / sqrt(numLines)
+
+        for (auto& line : x)
+            for (int t = 0; t < n; ++t)
+                line[t] *= scale;
+    }
+
+    // Line lengths spread geometrically over 23-71 ms, with an irrational ratio
+    // between neighbours so no two lines share modes. Interleaved so both
+    // output taps see short and long lines.
+    static double getLineLengthMs(int index)
+    {
+        const int rank = (index * 3) % numLines;  // 3 is coprime with 8 and 16
+        return 23.0 * std::pow(71.0 / 23.0, static_cast<double>(rank) / (numLines - 1)) * (1.0 + 0.0137 * std::sqrt(static_cast<double>(rank)));
+    }
+
+    // Delay targets and damping filters from size / decay / damping (Jot's
+    // absorbent delay lines: per-line gains from each line's own length)
+    void updateTargets()
+    {
+        coefficientsDirty = false;
+
+        const double sizeScale = minSizeScale + (maxSizeScale - minSizeScale) * size;
+        const double lowT60 = decaySeconds;
+        const double highT60 = decaySeconds * (1.0 - 0.9 * damping);
+
+        for (int i = 0; i < numLines; ++i)
+        {
+            const double length = juce::jmax(static_cast<double>(minimumDelay),
+                                             std::round(getLineLengthMs(i) * sizeScale * 0.001 * sampleRate));
+            targetDelay[i] = static_cast<float>(length);
+
+            // g = 10^(-3 L / (fs T60)): -60 dB after T60 seconds of round trips
+            const double dcGain = std::pow(10.0, -3.0 * length / (sampleRate * lowT60));
+            const double nyquistGain = std::pow(10.0, -3.0 * length / (sampleRate * highT60));
+
+            // One-pole b / (1 - a z^-1): DC gain b / (1 - a), Nyquist gain b / (1 + a)
+            const double ratio = nyquistGain / dcGain;
+            const double pole = (1.0 - ratio) / (1.0 + ratio);
+            damperPole[i] = static_cast<float>(pole);
+            damperGain[i] = static_cast<float>(dcGain * (1.0 - pole));
+        }
+    }
+
+    // Taps must stay behind everything written this chunk (cubic reads one newer sample)
+    static constexpr int minimumDelay = chunkSize + 3;
+
+    // Tap movement per chunk above which the delay is ramped per sample
+    static constexpr float maxStepPerChunk = 0.25f;
+
+    static constexpr double minSizeScale = 0.25;
+    static constexpr double maxSizeScale = 1.5;
+    static constexpr double maxModulationMs = 0.5;
+
+    // Input: even lines from left, odd from right (with Hadamard row 3 signs)
+    static constexpr float inputGain = 0.5f;
+    static constexpr float outputGain = 1.4142136f;
+
+    // Entry (row, column) of the unnormalised Hadamard matrix: (-1)^popcount(row & column)
+    static float hadamardSign(int row, int column)
+    {
+        int bits = row & column, parity = 0;
+
+        for (; bits != 0; bits >>= 1)
+            parity ^= bits & 1;
+
+        return parity != 0 ? -1.0f : 1.0f;
+    }
+
+    std::vector<float> lines;  // numLines circular buffers of `capacity` samples
+    int capacity = 0;
+    int mask = 0;
+    int writeIndex = 0;
+
+    double sampleRate = 44100.0;
+    float decaySeconds = 2.0f;
+    float damping = 0.5f;
+    float size = 0.5f;
+    float modulationDepth = 0.0f;
+    bool coefficientsDirty = true;
+
+    alignas(32) float targetDelay[numLines] {};
+    alignas(32) float lineDelay[numLines] {};
+    alignas(32) float tapDelay[numLines] {};
+    alignas(32) float damperGain[numLines] {};
+    alignas(32) float damperPole[numLines] {};
+    alignas(32) float filterState[numLines] {};
+    alignas(32) float lfoPhase[numLines] {};
+    alignas(32) float lfoIncrement[numLines] {};
+    alignas(32) float inputSign[numLines] {};
+};
+
+using FdnReverb8 = FdnReverb<8>;
+using FdnReverb16 = FdnReverb<16>;
+
+} // namespace pfs
@@ -0,0 +1,146 @@
+#pragma once
+#include <juce_data_structures/juce_data_structures.h>
+#include "FdnReverb.h"
+#include "PartitionedConvolution.h"
+
+namespace pfs
+{
+
+// The reverb section shared by FlutterVerb and DriveVerb: an FdnReverb8 and
+// an impulse-response PartitionedConvolution behind one mode switch.
+//
+// The IR mode plays only once an IR is actually in place (the FDN covers for
+// a missing or still loading file). Switching crossfades the two engines over
+// modeCrossfadeSeconds; both run only during the fade, and the engine coming
+// in is flushed first so it starts from silence. The IR file is saved with
+// the plugin state by path (saveState / restoreState).
+//
+// Offline renders are reproducible: restoreState() can load the IR before it
+// returns, and process() waits for a background load to finish when the host
+// renders non-realtime.
+//
+// Stereo in, stereo out, wet only, in place.
+class HybridReverb
+{
+public:
+    static constexpr double modeCrossfadeSeconds = 0.05;
+
+    // Message thread, audio stopped (allocates). irModeSelected: the mode
+    // parameter, so the section starts in the right mode without a fade.
+    void prepare(double sampleRate, int maximumBlockSize, bool irModeSelected)
+    {
+        fdn.prepare(sampleRate);
+        convolution.prepare(sampleRate, maximumBlockSize);
+        fdnScratch.setSize(2, maximumBlockSize, false, false, true);
+        irMix.reset(sampleRate, modeCrossfadeSeconds);
+        irMix.setCurrentAndTargetValue(isUsingImpulseResponse(irModeSelected) ? 1.0f : 0.0f);
+    }
+
+    // Audio thread: flush both engines (tail sleep, transport restart)
+    void reset()
+    {
+        fdn.reset();
+        convolution.reset();
+    }
+
+    // FDN settings (see FdnReverb)
+    void setDecaySeconds(float seconds) { fdn.setDecaySeconds(seconds); }
+    void setDamping(float damping) { fdn.setDamping(damping); }
+    void setSize(float size) { fdn.setSize(size); }
+    void setModulation(float amount) { fdn.setModulation(amount); }
+
+    // Message thread. synchronous: decode and build before returning (offline).
+    void loadImpulseResponse(const juce::File& file, bool synchronous = false)
+    {
+        convolution.loadImpulseResponse(file, synchronous);
+    }
+
+    // Any thread: the IR mode is selected and an IR is playing
+    bool isUsingImpulseResponse(bool irModeSelected) const
+    {
+        return irModeSelected && convolution.getLengthSeconds() > 0.0;
+    }
+
+    // Any thread: length of the playing IR in seconds (0 = none)
+    double getImpulseResponseSeconds() const { return convolution.getLengthSeconds(); }
+
+    // Message thread: the IR file is referenced by path, not embedded
+    void saveState(juce::ValueTree& state) const
+    {
+        state.setProperty(irFileProperty, convolution.getFile().getFullPathName(), nullptr);
+    }
+
+    void restoreState(const juce::ValueTree& state, bool synchronous)
+    {
+        const juce::File irFile(state.getProperty(irFileProperty).toString());
+
+        if (irFile.existsAsFile())
+            loadImpulseResponse(irFile, synchronous);
+    }
+
+    // Audio thread. Mono buffers feed the left channel to both inputs and keep
+    // the left output.
+    void process(juce::AudioBuffer<float>& buffer, bool irModeSelected, bool nonRealtime)
+    {
+        const int numSamples = buffer.getNumSamples();
+        auto* left = buffer.getWritePointer(0);
+        auto* right = buffer.getNumChannels() > 1 ? buffer.getWritePointer(1) : nullptr;
+        const float* rightInput = right != nullptr ? right : left;  // Mono input feeds both sides
+
+        // Offline renders must not depend on how fast the loader thread is
+        if (nonRealtime && convolution.isLoading())
+            convolution.waitForLoad();
+
+        // Pick up a finished IR even while the FDN plays, so the IR mode turns
+        // on only once the engine is actually in place
+        convolution.updateEngine();
+
+        // Mode switch: flush the engine coming in so it starts from silence
+        const bool irMode = isUsingImpulseResponse(irModeSelected);
+
+        if (irMode != (irMix.getTargetValue() > 0.5f))
+        {
+            if (irMode)
+                convolution.reset();
+            else
+                fdn.reset();
+
+            irMix.setTargetValue(irMode ? 1.0f : 0.0f);
+        }
+
+        if (! irMix.isSmoothing())
+        {
+            if (irMode)
+                convolution.process(left, rightInput, left, right, numSamples);
+            else
+                fdn.process(left, rightInput, left, right, numSamples);
+
+            return;
+        }
+
+        // Crossfade: FDN into scratch, convolution in place, then blend
+        auto* fdnLeft = fdnScratch.getWritePointer(0);
+        auto* fdnRight = right != nullptr ? fdnScratch.getWritePointer(1) : nullptr;
+        fdn.process(left, rightInput, fdnLeft, fdnRight, numSamples);
+        convolution.process(left, rightInput, left, right, numSamples);
+
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            const float mix = irMix.getNextValue();
+            left[sample] = fdnLeft[sample] + mix * (left[sample] - fdnLeft[sample]);
+
+            if (right != nullptr)
+                right[sample] = fdnRight[sample] + mix * (right[sample] - fdnRight[sample]);
+        }
+    }
+
+private:
+    static constexpr const char* irFileProperty = "irFile";
+
+    FdnReverb8 fdn;
+    PartitionedConvolution convolution;
+    juce::SmoothedValue<float> irMix;     // 0 = FDN, 1 = convolution
+    juce::AudioBuffer<float> fdnScratch;  // FDN output during a mode crossfade
+};
+
+} // namespace pfs
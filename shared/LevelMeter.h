@@ -0,0 +1,440 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "TruePeak.h"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace pfs
+{
+
+// One meter reading (dB / LUFS, floored at minimumDb)
+struct MeterReading
+{
+    static constexpr float minimumDb = -100.0f;
+
+    float samplePeakDb = minimumDb;   // Highest sample in the interval
+    float truePeakDb = minimumDb;     // Highest 4x-interpolated value (dBTP), >= samplePeakDb
+    float rmsDb = minimumDb;          // Louder channel, with attack/release ballistics
+    float momentaryLufs = minimumDb;  // BS.1770 K-weighted, 400ms window
+    float shortTermLufs = minimumDb;  // BS.1770 K-weighted, 3s window
+};
+
+// Sample-peak, true-peak, RMS and loudness metering for an insert, cheap
+// enough to leave on in every instance.
+//
+// The audio thread measures a block at a time and publishes one MeterReading
+// every updateSeconds (block-size independent) into a lock-free history ring.
+// UIs read the ring at their own frame rate with their own cursor, so a peak
+// between two frames is never missed.
+//
+//  - True peak (ITU-R BS.1770-4 Annex 2): 4x oversampling with the 48-tap
+//    polyphase pfs::TruePeakKernel. The three in-between phases run tap by tap
+//    over the block, so they vectorise; phase 0 is the sample itself.
+//  - Loudness (BS.1770): K-weighting (shelf + RLB high-pass, derived for any
+//    sample rate) in double precision; mean square per 10ms interval into a
+//    3s ring; momentary = last 400ms, short-term = last 3s. All channels are
+//    weighted 1.0 (no surround weighting).
+//  - RMS: per-channel mean square per interval, smoothed with separate
+//    attack/release time constants (default 300ms, VU-like).
+//
+// RMS and loudness are optional (Measurements::peaksOnly skips their
+// per-sample work and reports them as minimumDb), for meters whose UI only
+// shows peaks. No allocation after prepare().
+class LevelMeter
+{
+public:
+    static constexpr double updateSeconds = 0.01;  // One reading per 10ms
+    static constexpr int historySize = 256;        // 2.56s of readings (power of two)
+
+    enum class Measurements { peaksOnly, all };
+
+    // Message thread, audio stopped (allocates)
+    void prepare(double newSampleRate, int newNumChannels, Measurements newMeasurements = Measurements::all)
+    {
+        sampleRate = newSampleRate;
+        interval = juce::jmax(1, juce::roundToInt(sampleRate * updateSeconds));
+        channels.resize(static_cast<size_t>(juce::jmax(1, newNumChannels)));
+        measureLevels = newMeasurements == Measurements::all;
+
+        makeKWeighting();
+        setRmsBallistics(rmsAttackSeconds, rmsReleaseSeconds);
+        reset();
+    }
+
+    // Message thread, audio stopped (before or after prepare()); the audio
+    // thread reads the coefficients unsynchronised
+    void setRmsBallistics(double attackSeconds, double releaseSeconds)
+    {
+        rmsAttackSeconds = attackSeconds;
+        rmsReleaseSeconds = releaseSeconds;
+        rmsAttack = ballisticsCoefficient(attackSeconds);
+        rmsRelease = ballisticsCoefficient(releaseSeconds);
+    }
+
+    // Audio thread (or audio stopped)
+    void reset()
+    {
+        for (auto& c : channels)
+            c = {};
+
+        energies.fill(0.0);
+        energyIndex = 0;
+        fill = 0;
+    }
+
+    // Audio thread
+    void process(const juce::AudioBuffer<float>& buffer)
+    {
+        process(buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples());
+    }
+
+    void process(const float* const* data, int numChannels, int numSamples)
+    {
+        numChannels = juce::jmin(numChannels, static_cast<int>(channels.size()));
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, interval - fill);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                measure(channels[static_cast<size_t>(ch)], data[ch] + done, count);
+
+            done += count;
+            fill += count;
+
+            if (fill == interval)
+                publish();
+        }
+    }
+
+    // Audio thread: the block is known to be silent (e.g. a plugin in tail
+    // sleep). Readings keep flowing and fall to silence, without the filtering.
+    void processSilence(int numSamples)
+    {
+        for (auto& c : channels)
+        {
+            c.truePeakHistory.fill(0.0f);
+            c.shelf = {};
+            c.highPass = {};
+        }
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, interval - fill);
+            done += count;
+            fill += count;
+
+            if (fill == interval)
+                publish();
+        }
+    }
+
+    // Any thread: readings published after `position` (oldest first), at most
+    // maxReadings; advances position. Readings overwritten before they could
+    // be read are skipped.
+    int readHistory(juce::uint64& position, MeterReading* dest, int maxReadings) const
+    {
+        const auto written = numWritten.load(std::memory_order_acquire);
+        position = juce::jmax(position, written > historySize - 1 ? written - (historySize - 1) : 0);
+
+        int count = 0;
+
+        for (; position < written && count < maxReadings; ++position)
+        {
+            const auto& slot = history[static_cast<size_t>(position % historySize)];
+            MeterReading reading;
+            reading.samplePeakDb = slot[0].load(std::memory_order_relaxed);
+            reading.truePeakDb = slot[1].load(std::memory_order_relaxed);
+            reading.rmsDb = slot[2].load(std::memory_order_relaxed);
+            reading.momentaryLufs = slot[3].load(std::memory_order_relaxed);
+            reading.shortTermLufs = slot[4].load(std::memory_order_relaxed);
+
+            // Seqlock check: if any load above saw a store of a writer that has
+            // wrapped onto this slot, the fences make its numStarted visible here
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (numStarted.load(std::memory_order_relaxed) - position < historySize)
+                dest[count++] = reading;
+        }
+
+        return count;
+    }
+
+    // Any thread: one reading summarising everything since `position` - the
+    // highest peaks, the latest RMS and loudness. For single-value meters.
+    MeterReading readSince(juce::uint64& position) const
+    {
+        std::array<MeterReading, 32> readings;
+        MeterReading summary;
+        bool any = false;
+
+        for (int count; (count = readHistory(position, readings.data(), static_cast<int>(readings.size()))) > 0;)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                const auto& r = readings[static_cast<size_t>(i)];
+                summary.samplePeakDb = any ? juce::jmax(summary.samplePeakDb, r.samplePeakDb) : r.samplePeakDb;
+                summary.truePeakDb = any ? juce::jmax(summary.truePeakDb, r.truePeakDb) : r.truePeakDb;
+                summary.rmsDb = r.rmsDb;
+                summary.momentaryLufs = r.momentaryLufs;
+                summary.shortTermLufs = r.shortTermLufs;
+                any = true;
+            }
+        }
+
+        if (! any)
+            summary = latest.load();
+
+        return summary;
+    }
+
+private:
+    static constexpr int truePeakHistorySize = TruePeakKernel::taps - 1;
+    static constexpr int chunkSize = 64;
+    static constexpr int momentaryIntervals = 40;   // 400ms
+    static constexpr int shortTermIntervals = 300;  // 3s
+
+    struct Biquad
+    {
+        double z1 = 0.0, z2 = 0.0;
+    };
+
+    struct Channel
+    {
+        std::array<float, truePeakHistorySize + chunkSize> truePeakHistory {};  // Previous taps + current chunk
+        Biquad shelf, highPass;
+        float peak = 0.0f;
+        float truePeak = 0.0f;
+        double sumSquares = 0.0;
+        double weightedSumSquares = 0.0;
+        double rmsState = 0.0;  // Ballistic mean square
+    };
+
+    struct Coefficients
+    {
+        double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+    };
+
+    // Lock-free "latest" copy for readSince() before anything new arrives
+    struct LatestReading
+    {
+        std::array<std::atomic<float>, 5> values {};
+
+        void store(const MeterReading& r)
+        {
+            values[0].store(r.samplePeakDb, std::memory_order_relaxed);
+            values[1].store(r.truePeakDb, std::memory_order_relaxed);
+            values[2].store(r.rmsDb, std::memory_order_relaxed);
+            values[3].store(r.momentaryLufs, std::memory_order_relaxed);
+            values[4].store(r.shortTermLufs, std::memory_order_relaxed);
+        }
+
+        MeterReading load() const
+        {
+            MeterReading r;
+            r.samplePeakDb = values[0].load(std::memory_order_relaxed);
+            r.truePeakDb = values[1].load(std::memory_order_relaxed);
+            r.rmsDb = values[2].load(std::memory_order_relaxed);
+            r.momentaryLufs = values[3].load(std::memory_order_relaxed);
+            r.shortTermLufs = values[4].load(std::memory_order_relaxed);
+            return r;
+        }
+    };
+
+    void measure(Channel& c, const float* x, int numSamples)
+    {
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, chunkSize);
+            const float* in = x + done;
+
+            // Sample peak
+            const auto range = juce::FloatVectorOperations::findMinAndMax(in, count);
+            c.peak = juce::jmax(c.peak, -range.getStart(), range.getEnd());
+
+            // True peak: phases 1-3, tap by tap over the chunk
+            float* buffer = c.truePeakHistory.data();
+            std::copy(in, in + count, buffer + truePeakHistorySize);
+
+            for (int phase = 1; phase < TruePeakKernel::phases; ++phase)
+            {
+                std::array<float, chunkSize> interpolated;
+                TruePeakKernel::interpolate(buffer, count, phase, interpolated.data());
+
+                const auto range = juce::FloatVectorOperations::findMinAndMax(interpolated.data(), count);
+                c.truePeak = juce::jmax(c.truePeak, -range.getStart(), range.getEnd());
+            }
+
+            std::copy(buffer + count, buffer + count + truePeakHistorySize, buffer);
+
+            if (measureLevels)
+            {
+                // Plain sum of squares (lane-split so it vectorises)
+                std::array<float, 8> lanes {};
+
+                for (int i = 0; i < count; ++i)
+                    lanes[static_cast<size_t>(i & 7)] += in[i] * in[i];
+
+                for (auto lane : lanes)
+                    c.sumSquares += lane;
+
+                // K-weighting (transposed direct form II, double)
+                double weighted = 0.0;
+
+                for (int i = 0; i < count; ++i)
+                {
+                    const double s = filter(shelf, c.shelf, static_cast<double>(in[i]));
+                    const double z = filter(highPass, c.highPass, s);
+                    weighted += z * z;
+                }
+
+                c.weightedSumSquares += weighted;
+            }
+
+            done += count;
+        }
+    }
+
+    static double filter(const Coefficients& k, Biquad& state, double x)
+    {
+        const double y = k.b0 * x + state.z1;
+        state.z1 = k.b1 * x - k.a1 * y + state.z2;
+        state.z2 = k.b2 * x - k.a2 * y;
+        return y;
+    }
+
+    void publish()
+    {
+        float peak = 0.0f, truePeak = 0.0f;
+        double loudestMeanSquare = 0.0, energy = 0.0;
+
+        for (auto& c : channels)
+        {
+            const double meanSquare = c.sumSquares / interval;
+            c.rmsState += (meanSquare > c.rmsState ? rmsAttack : rmsRelease) * (meanSquare - c.rmsState);
+
+            peak = juce::jmax(peak, c.peak);
+            truePeak = juce::jmax(truePeak, c.truePeak, c.peak);
+            loudestMeanSquare = juce::jmax(loudestMeanSquare, c.rmsState);
+            energy += c.weightedSumSquares / interval;
+
+            c.peak = c.truePeak = 0.0f;
+            c.sumSquares = c.weightedSumSquares = 0.0;
+        }
+
+        MeterReading reading;
+        reading.samplePeakDb = gainToDb(peak);
+        reading.truePeakDb = gainToDb(truePeak);
+
+        if (measureLevels)
+        {
+            energies[static_cast<size_t>(energyIndex)] = energy;
+            energyIndex = (energyIndex + 1) % shortTermIntervals;
+
+            double momentary = 0.0, shortTerm = 0.0;
+
+            for (int i = 0; i < shortTermIntervals; ++i)
+            {
+                const double e = energies[static_cast<size_t>((energyIndex + i) % shortTermIntervals)];
+                shortTerm += e;
+
+                if (i >= shortTermIntervals - momentaryIntervals)
+                    momentary += e;
+            }
+
+            reading.rmsDb = powerToDb(loudestMeanSquare, 0.0);
+            reading.momentaryLufs = powerToDb(momentary / momentaryIntervals, -0.691);
+            reading.shortTermLufs = powerToDb(shortTerm / shortTermIntervals, -0.691);
+        }
+
+        // Announce the slot before overwriting it (the release fence orders the
+        // announcement before the slot stores), publish it after
+        const auto written = numWritten.load(std::memory_order_relaxed);
+        numStarted.store(written + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto& slot = history[static_cast<size_t>(written % historySize)];
+        slot[0].store(reading.samplePeakDb, std::memory_order_relaxed);
+        slot[1].store(reading.truePeakDb, std::memory_order_relaxed);
+        slot[2].store(reading.rmsDb, std::memory_order_relaxed);
+        slot[3].store(reading.momentaryLufs, std::memory_order_relaxed);
+        slot[4].store(reading.shortTermLufs, std::memory_order_relaxed);
+        numWritten.store(written + 1, std::memory_order_release);
+        latest.store(reading);
+
+        fill = 0;
+    }
+
+    static float gainToDb(float gain)
+    {
+        return juce::Decibels::gainToDecibels(gain, MeterReading::minimumDb);
+    }
+
+    static float powerToDb(double power, double offset)
+    {
+        return power > 0.0 ? juce::jmax(MeterReading::minimumDb, static_cast<float>(offset + 10.0 * std::log10(power)))
+                           : MeterReading::minimumDb;
+    }
+
+    // One-pole coefficient per reading for a time constant in seconds
+    static double ballisticsCoefficient(double seconds)
+    {
+        return seconds > 0.0 ? 1.0 - std::exp(-updateSeconds / seconds) : 1.0;
+    }
+
+    // BS.1770 pre-filter (high shelf) and RLB weighting (high-pass), from the
+    // analogue prototypes so they hold at any sample rate (bit-for-bit the
+    // published 48kHz coefficients at 48kHz)
+    void makeKWeighting()
+    {
+        constexpr double pi = juce::MathConstants<double>::pi;
+
+        {
+            const double f0 = 1681.974450955533, gainDb = 3.999843853973347, q = 0.7071752369554196;
+            const double k = std::tan(pi * f0 / sampleRate);
+            const double vh = std::pow(10.0, gainDb / 20.0);
+            const double vb = std::pow(vh, 0.4996667741545416);
+            const double a0 = 1.0 + k / q + k * k;
+
+            shelf.b0 = (vh + vb * k / q + k * k) / a0;
+            shelf.b1 = 2.0 * (k * k - vh) / a0;
+            shelf.b2 = (vh - vb * k / q + k * k) / a0;
+            shelf.a1 = 2.0 * (k * k - 1.0) / a0;
+            shelf.a2 = (1.0 - k / q + k * k) / a0;
+        }
+
+        {
+            const double f0 = 38.13547087602444, q = 0.5003270373238773;
+            const double k = std::tan(pi * f0 / sampleRate);
+            const double a0 = 1.0 + k / q + k * k;
+
+            highPass.b0 = 1.0;
+            highPass.b1 = -2.0;
+            highPass.b2 = 1.0;
+            highPass.a1 = 2.0 * (k * k - 1.0) / a0;
+            highPass.a2 = (1.0 - k / q + k * k) / a0;
+        }
+    }
+
+    double sampleRate = 44100.0;
+    int interval = 441;
+    int fill = 0;
+
+    Coefficients shelf, highPass;
+    std::vector<Channel> channels;
+    std::array<double, shortTermIntervals> energies {};
+    int energyIndex = 0;
+
+    bool measureLevels = true;  // RMS and loudness (Measurements::all)
+    double rmsAttackSeconds = 0.3, rmsReleaseSeconds = 0.3;
+    double rmsAttack = 1.0, rmsRelease = 1.0;  // Per-reading one-pole coefficients
+
+    std::array<std::array<std::atomic<float>, 5>, historySize> history {};
+    std::atomic<juce::uint64> numStarted { 0 };  // Readings being or already written
+    std::atomic<juce::uint64> numWritten { 0 };  // Readings complete
+    LatestReading latest;
+};
+
+} // namespace pfs
@@ -0,0 +1,175 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <cstdint>
+
+namespace pfs
+{
+
+// Per-voice noise generator for audio-thread use (replaces juce::Random and
+// juce::Random::getSystemRandom() in DSP loops).
+//
+// Eight independent xoshiro128+ streams are stored as structure-of-arrays so
+// one generator step is a fixed 8-lane integer loop that the compiler turns
+// into SIMD. Block fills write 8 values per step; scalar calls draw from a
+// small cache refilled the same way, so both paths share one stream.
+//
+// No global state: every voice/instance owns its NoiseSource. Seeding is
+// deterministic (splitmix64 expansion of a 64-bit seed), so re-seeding in
+// prepareToPlay() makes offline renders reproducible. Use streamSeed() to
+// derive decorrelated seeds for several voices from one base seed.
+class NoiseSource
+{
+public:
+    static constexpr int numLanes = 8;
+
+    explicit NoiseSource(uint64_t seed = 0x8a5cd789635d2dffull) { setSeed(seed); }
+
+    // Decorrelated seed for sub-stream `index` of `baseSeed`
+    static uint64_t streamSeed(uint64_t baseSeed, int index)
+    {
+        uint64_t state = baseSeed ^ (0x9e3779b97f4a7c15ull * static_cast<uint64_t>(index + 1));
+        return splitMix64(state);
+    }
+
+    void setSeed(uint64_t seed)
+    {
+        uint64_t state = seed;
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const uint64_t a = splitMix64(state);
+            const uint64_t b = splitMix64(state);
+            s0[lane] = static_cast<uint32_t>(a);
+            s1[lane] = static_cast<uint32_t>(a >> 32);
+            s2[lane] = static_cast<uint32_t>(b);
+            s3[lane] = static_cast<uint32_t>(b >> 32) | 1u;  // never all-zero
+        }
+
+        cacheIndex = numLanes;
+        pink = {};
+    }
+
+    // Uniform in [0, 1)
+    inline float nextUniform()
+    {
+        if (cacheIndex >= numLanes)
+        {
+            step(cache);
+            cacheIndex = 0;
+        }
+
+        return cache[cacheIndex++];
+    }
+
+    // Uniform in [-1, 1)
+    inline float nextBipolar() { return nextUniform() * 2.0f - 1.0f; }
+
+    // Integer in [0, maxExclusive)
+    inline int nextInt(int maxExclusive)
+    {
+        return juce::jmin(maxExclusive - 1, static_cast<int>(nextUniform() * static_cast<float>(maxExclusive)));
+    }
+
+    // dest[i] = uniform [0, 1)
+    void fillUniform(float* dest, int numSamples)
+    {
+        int i = 0;
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+            step(dest + i);
+
+        for (; i < numSamples; ++i)
+            dest[i] = nextUniform();
+    }
+
+    // dest[i] = gain * uniform [-1, 1)
+    void fillBipolar(float* dest, int numSamples, float gain = 1.0f)
+    {
+        fillUniform(dest, numSamples);
+
+        const float scale = 2.0f * gain;
+
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = dest[i] * scale - gain;
+    }
+
+    // Approximately Gaussian (Irwin-Hall, sum of 4 uniforms), standard deviation sigma
+    void fillGaussian(float* dest, int numSamples, float sigma = 1.0f)
+    {
+        // Sum of 4 U[0,1): mean 2, variance 1/3
+        const float scale = sigma * 1.7320508f;
+        alignas(32) float u[4][numLanes];
+        int i = 0;
+
+        for (; i + numLanes <= numSamples; i += numLanes)
+        {
+            for (auto& row : u)
+                step(row);
+
+            for (int lane = 0; lane < numLanes; ++lane)
+                dest[i + lane] = (u[0][lane] + u[1][lane] + u[2][lane] + u[3][lane] - 2.0f) * scale;
+        }
+
+        for (; i < numSamples; ++i)
+            dest[i] = (nextUniform() + nextUniform() + nextUniform() + nextUniform() - 2.0f) * scale;
+    }
+
+    // Pink (-3 dB/octave) noise, peak roughly ±gain (Paul Kellet's economy filter
+    // on top of a vectorised white fill; filter state persists across calls)
+    void fillPink(float* dest, int numSamples, float gain = 1.0f)
+    {
+        fillBipolar(dest, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float white = dest[i];
+            pink.b0 = 0.99765f * pink.b0 + white * 0.0990460f;
+            pink.b1 = 0.96300f * pink.b1 + white * 0.2965164f;
+            pink.b2 = 0.57000f * pink.b2 + white * 1.0526913f;
+            dest[i] = (pink.b0 + pink.b1 + pink.b2 + white * 0.1848f) * 0.25f * gain;
+        }
+    }
+
+private:
+    static uint64_t splitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    static inline uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    // One xoshiro128+ step on all lanes; writes numLanes floats in [0, 1)
+    inline void step(float* out)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const uint32_t result = s0[lane] + s3[lane];
+            const uint32_t t = s1[lane] << 9;
+
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= t;
+            s3[lane] = rotl(s3[lane], 11);
+
+            // Top 24 bits → exact float in [0, 1)
+            out[lane] = static_cast<float>(result >> 8) * (1.0f / 16777216.0f);
+        }
+    }
+
+    struct PinkState { float b0 = 0.0f, b1 = 0.0f, b2 = 0.0f; };
+
+    alignas(32) uint32_t s0[numLanes] {};
+    alignas(32) uint32_t s1[numLanes] {};
+    alignas(32) uint32_t s2[numLanes] {};
+    alignas(32) uint32_t s3[numLanes] {};
+    alignas(32) float cache[numLanes] {};
+    int cacheIndex = numLanes;
+    PinkState pink;
+};
+
+} // namespace pfs
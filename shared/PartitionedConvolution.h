@@ -0,0 +1,1036 @@
+#pragma once
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_dsp/juce_dsp.h>
+#include <juce_events/juce_events.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace pfs
+{
+
+class ConvolutionEngine;
+
+// A pool of background real-time threads, one per spare hardware thread and
+// shared by every ConvolutionEngine in the process, that computes the long
+// tail partitions. Engines register on construction and unregister on
+// destruction (never on the audio thread); jobs are handed over through
+// per-engine atomic slot states, so the audio thread never locks. Posting a
+// job wakes one thread (no polling), and a thread that picks a job up wakes
+// the next, so a burst of jobs from many engines spreads over the pool.
+class ConvolutionWorker
+{
+public:
+    static constexpr int maxThreads = 16;
+
+    ConvolutionWorker()
+    {
+        const int numThreads = juce::jlimit(1, maxThreads, juce::SystemStats::getNumCpus() - 1);
+
+        for (int i = 0; i < numThreads; ++i)
+        {
+            auto* runner = runners.add(new Runner(*this, i));
+
+            if (! runner->startRealtimeThread(juce::Thread::RealtimeOptions {}.withPriority(8)))
+                runner->startThread(juce::Thread::Priority::highest);
+        }
+    }
+
+    ~ConvolutionWorker()
+    {
+        for (auto* runner : runners)
+        {
+            runner->signalThreadShouldExit();
+            runner->notify();
+        }
+
+        for (auto* runner : runners)
+            runner->stopThread(2000);
+    }
+
+    void add(ConvolutionEngine* engine)
+    {
+        const juce::ScopedWriteLock sl(lock);
+        engines.addIfNotAlreadyThere(engine);
+    }
+
+    // Blocks while any thread is inside a job, so the engine can be freed afterwards
+    void remove(ConvolutionEngine* engine)
+    {
+        const juce::ScopedWriteLock sl(lock);
+        engines.removeFirstMatchingValue(engine);
+    }
+
+    // Audio thread, after posting a job: wake the threads in turn
+    void notify()
+    {
+        const auto next = nextRunner.fetch_add(1, std::memory_order_relaxed);
+        runners.getUnchecked(static_cast<int>(next % static_cast<unsigned int>(runners.size())))->notify();
+    }
+
+private:
+    class Runner : public juce::Thread
+    {
+    public:
+        Runner(ConvolutionWorker& o, int i) : juce::Thread("pfs convolution " + juce::String(i)), owner(o), index(i) {}
+
+        void run() override
+        {
+            while (! threadShouldExit())
+                if (! owner.runOneJob(index))
+                    wait(-1);
+        }
+
+    private:
+        ConvolutionWorker& owner;
+        const int index;
+    };
+
+    bool runOneJob(int runnerIndex);
+
+    juce::ReadWriteLock lock;
+    juce::Array<ConvolutionEngine*> engines;
+    juce::OwnedArray<Runner> runners;
+    std::atomic<unsigned int> nextRunner { 0 };
+};
+
+// Zero-latency, non-uniformly partitioned convolution of a stereo signal with a
+// fixed mono or stereo impulse response (mono IRs feed both sides).
+//
+// The IR is split into three segments (Gardner):
+//   [0, B)        direct-form FIR, on the audio thread
+//   [B, 2T)       uniform FFT partitions of size B, on the audio thread
+//   [2T, end)     uniform FFT partitions of size T, on the ConvolutionWorker
+// with B = headSize and T = tailSize. Each FFT stage adds exactly one
+// partition of delay, which the segment offsets absorb, so the sum is the
+// exact convolution with no latency. A tail block is handed to the worker as
+// soon as its T input samples are in and is not due for another T samples,
+// which is the worker's deadline. If no thread has picked the job up halfway
+// to the deadline (overload, offline rendering faster than real time), the
+// audio thread claims it and spreads it over the head blocks that are left,
+// a share of the partitions per block, so a late job never lands on a single
+// callback. Only a job a worker is already inside is waited for, and that
+// wait is bounded by the rest of one job.
+//
+// Engines are immutable per IR: built (allocating, FFT-ing the IR) off the
+// audio thread and swapped in by PartitionedConvolution.
+class ConvolutionEngine
+{
+public:
+    static constexpr int headSize = 128;
+    static constexpr int tailSize = 4096;
+    static constexpr int headEnd = 2 * tailSize;  // IR offset where the tail stage starts
+
+    // ir: 1 or 2 channels at the processing sample rate (not on the audio thread)
+    explicit ConvolutionEngine(const juce::AudioBuffer<float>& ir)
+        : irLength(ir.getNumSamples()),
+          numIrChannels(juce::jlimit(1, 2, ir.getNumChannels()))
+    {
+        numHeadPartitions = juce::jlimit(0, (headEnd - headSize) / headSize,
+                                         (irLength - headSize + headSize - 1) / headSize);
+        numTailPartitions = juce::jmax(0, (irLength - headEnd + tailSize - 1) / tailSize);
+
+        for (int ch = 0; ch < numIrChannels; ++ch)
+        {
+            const float* h = ir.getReadPointer(ch);
+            auto& k = kernels[static_cast<size_t>(ch)];
+
+            // Direct taps, reversed so the FIR is a forward dot product
+            k.direct.assign(static_cast<size_t>(headSize), 0.0f);
+            for (int i = 0; i < juce::jmin(headSize, irLength); ++i)
+                k.direct[static_cast<size_t>(headSize - 1 - i)] = h[i];
+
+            k.head = makePartitionSpectra(headFft, h, irLength, headSize, numHeadPartitions, headSize);
+            k.tail = makePartitionSpectra(tailFft, h, irLength, headEnd, numTailPartitions, tailSize);
+        }
+
+        for (auto& c : channels)
+        {
+            c.history.assign(static_cast<size_t>(2 * headSize), 0.0f);
+            c.headInput.assign(static_cast<size_t>(2 * headSize), 0.0f);
+            c.headOutput.assign(static_cast<size_t>(headSize), 0.0f);
+            c.headSpectra.assign(static_cast<size_t>(numHeadPartitions * spectrumSize(headSize)), 0.0f);
+            c.tailInput.assign(static_cast<size_t>(tailSize), 0.0f);
+            c.tailFrame.assign(static_cast<size_t>(2 * tailSize), 0.0f);
+            c.tailSpectra.assign(static_cast<size_t>(numTailPartitions * spectrumSize(tailSize)), 0.0f);
+        }
+
+        for (auto& slot : slots)
+            for (auto& buffer : { &slot.input, &slot.output })
+                for (auto& v : *buffer)
+                    v.assign(static_cast<size_t>(tailSize), 0.0f);
+
+        headScratch.assign(static_cast<size_t>(4 * headSize), 0.0f);
+        headAccumulator.assign(static_cast<size_t>(4 * headSize), 0.0f);
+        tailScratch.assign(static_cast<size_t>(4 * tailSize), 0.0f);
+
+        for (auto& accumulator : tailAccumulators)
+            accumulator.assign(static_cast<size_t>(4 * tailSize), 0.0f);
+
+        if (numTailPartitions > 0)
+            worker->add(this);
+    }
+
+    ~ConvolutionEngine()
+    {
+        worker->remove(this);
+    }
+
+    int getLength() const { return irLength; }
+
+    // Audio thread: forget all input so far. Cheap and lock-free - the
+    // frequency-domain delay lines are not cleared but masked until refilled,
+    // and the tail job in flight still runs (in order) but is never emitted.
+    void reset()
+    {
+        for (auto& c : channels)
+            for (auto* v : { &c.history, &c.headInput, &c.headOutput })
+                std::fill(v->begin(), v->end(), 0.0f);
+
+        headFill = tailFill = 0;
+        headValid = 0;
+
+        if (emitSlot >= 0)
+            slots[static_cast<size_t>(emitSlot)].state.store(Free, std::memory_order_relaxed);
+
+        emitSlot = -1;
+        discardPendingJob = tailBlock > 0;
+        restartTail = true;
+    }
+
+    // Audio thread. in/out are two channels; out may alias in, in[0] may equal in[1].
+    void process(const float* const* in, float* const* out, int numSamples)
+    {
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, headSize - headFill);
+
+            // Stash both inputs before writing anything: out may alias in, and a
+            // mono source may feed both channels from one buffer
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                auto& c = channels[static_cast<size_t>(ch)];
+                const float* input = in[ch] + done;
+
+                std::copy(input, input + count, c.history.begin() + (headSize - 1));
+                std::copy(input, input + count, c.headInput.begin() + headSize + headFill);
+                std::copy(input, input + count, c.tailInput.begin() + tailFill);
+            }
+
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                auto& c = channels[static_cast<size_t>(ch)];
+                const auto& k = kernels[static_cast<size_t>(juce::jmin(ch, numIrChannels - 1))];
+                float* output = out[ch] + done;
+
+                // Head and tail stages were computed a block ahead; the direct
+                // FIR runs tap by tap over the whole run so it vectorises
+                alignas(32) float sum[headSize];
+                std::copy(c.headOutput.begin() + headFill, c.headOutput.begin() + headFill + count, sum);
+
+                if (emitSlot >= 0)
+                {
+                    const float* tail = slots[static_cast<size_t>(emitSlot)].output[static_cast<size_t>(ch)].data() + tailFill;
+
+                    for (int t = 0; t < count; ++t)
+                        sum[t] += tail[t];
+                }
+
+                for (int i = 0; i < headSize; ++i)
+                {
+                    const float tap = k.direct[static_cast<size_t>(i)];
+                    const float* x = c.history.data() + i;
+
+                    for (int t = 0; t < count; ++t)
+                        sum[t] += tap * x[t];
+                }
+
+                std::copy(sum, sum + count, output);
+
+                // Keep the last headSize - 1 inputs for the next FIR run
+                std::copy(c.history.begin() + count, c.history.begin() + count + (headSize - 1), c.history.begin());
+            }
+
+            done += count;
+            headFill += count;
+            tailFill += count;
+
+            if (headFill == headSize)
+            {
+                runHeadBlock();
+                headFill = 0;
+
+                if (tailFill < tailSize)
+                    stepLateTailJob();
+            }
+
+            if (tailFill == tailSize)
+            {
+                advanceTail();
+                tailFill = 0;
+            }
+        }
+    }
+
+    // Worker thread: claim the pending tail job, if any (-1 = none)
+    int claimTailJob()
+    {
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            int expected = Ready;
+
+            if (slots[i].state.compare_exchange_strong(expected, Running, std::memory_order_acq_rel))
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    // Worker thread, after claimTailJob(): compute the whole job
+    void runClaimedTailJob(int claimed)
+    {
+        auto& slot = slots[static_cast<size_t>(claimed)];
+        beginTailJob(slot);
+        finishTailJob(slot);
+        slot.state.store(Done, std::memory_order_release);
+    }
+
+private:
+    enum SlotState { Free, Ready, Running, Done };
+
+    struct TailSlot
+    {
+        std::atomic<int> state { Free };
+        bool restart = false;  // Clear the tail history before this block (after reset())
+        std::array<std::vector<float>, 2> input, output;
+    };
+
+    struct Kernel
+    {
+        std::vector<float> direct;  // headSize reversed taps
+        std::vector<float> head;    // numHeadPartitions spectra of 2 * headSize FFTs
+        std::vector<float> tail;    // numTailPartitions spectra of 2 * tailSize FFTs
+    };
+
+    struct Channel
+    {
+        std::vector<float> history;      // Last headSize - 1 inputs + current run (direct FIR)
+        std::vector<float> headInput;    // Previous + current head block (overlap-save frame)
+        std::vector<float> headOutput;   // Head contribution for the current block
+        std::vector<float> headSpectra;  // Frequency-domain delay line of input frames
+        std::vector<float> tailInput;    // Tail block being collected (audio thread)
+        std::vector<float> tailFrame;    // Previous + current tail block (job owner)
+        std::vector<float> tailSpectra;  // Tail frequency-domain delay line (job owner)
+    };
+
+    // Interleaved complex bins 0 .. N/2 of a 2 * partition real FFT
+    static constexpr int spectrumSize(int partition) { return 2 * partition + 2; }
+
+    static int fftOrder(int partition) { return juce::roundToInt(std::log2(2.0 * partition)); }
+
+    static std::vector<float> makePartitionSpectra(const juce::dsp::FFT& fft, const float* h, int length,
+                                                   int start, int numPartitions, int partition)
+    {
+        const int size = spectrumSize(partition);
+        std::vector<float> spectra(static_cast<size_t>(numPartitions * size), 0.0f);
+        std::vector<float> frame(static_cast<size_t>(4 * partition));
+
+        for (int p = 0; p < numPartitions; ++p)
+        {
+            std::fill(frame.begin(), frame.end(), 0.0f);
+
+            for (int i = 0; i < partition; ++i)
+            {
+                const int index = start + p * partition + i;
+                frame[static_cast<size_t>(i)] = index < length ? h[index] : 0.0f;
+            }
+
+            fft.performRealOnlyForwardTransform(frame.data(), true);
+            std::copy(frame.begin(), frame.begin() + size, spectra.begin() + p * size);
+        }
+
+        return spectra;
+    }
+
+    // acc += a * b over numBins interleaved complex bins
+    static void multiplyAccumulate(float* acc, const float* a, const float* b, int numBins)
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            const float ar = a[2 * k], ai = a[2 * k + 1];
+            const float br = b[2 * k], bi = b[2 * k + 1];
+            acc[2 * k]     += ar * br - ai * bi;
+            acc[2 * k + 1] += ar * bi + ai * br;
+        }
+    }
+
+    // One overlap-save step of a uniformly partitioned stage: FFT the newest
+    // frame into the delay line, sum partition products, inverse FFT, and
+    // return the last `partition` samples (the valid half). Only the newest
+    // numValid frames are used, so a reset never has to clear the delay line.
+    static void convolveFrame(const juce::dsp::FFT& fft, const float* frame, float* spectra, int& position, int& numValid,
+                              const float* kernel, int numPartitions, int partition,
+                              float* scratch, float* accumulator, float* output)
+    {
+        const int size = spectrumSize(partition);
+
+        std::copy(frame, frame + 2 * partition, scratch);
+        std::fill(scratch + 2 * partition, scratch + 4 * partition, 0.0f);
+        fft.performRealOnlyForwardTransform(scratch, true);
+        std::copy(scratch, scratch + size, spectra + position * size);
+
+        std::fill(accumulator, accumulator + 4 * partition, 0.0f);
+        numValid = juce::jmin(numValid + 1, numPartitions);
+
+        for (int p = 0, slot = position; p < numValid; ++p)
+        {
+            multiplyAccumulate(accumulator, spectra + slot * size, kernel + p * size, partition + 1);
+            slot = slot == 0 ? numPartitions - 1 : slot - 1;
+        }
+
+        position = position + 1 == numPartitions ? 0 : position + 1;
+
+        fft.performRealOnlyInverseTransform(accumulator);
+        std::copy(accumulator + partition, accumulator + 2 * partition, output);
+    }
+
+    void runHeadBlock()
+    {
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            auto& c = channels[static_cast<size_t>(ch)];
+            const auto& k = kernels[static_cast<size_t>(juce::jmin(ch, numIrChannels - 1))];
+            int position = headPosition;
+            int valid = headValid;
+
+            if (numHeadPartitions > 0)
+                convolveFrame(headFft, c.headInput.data(), c.headSpectra.data(), position, valid, k.head.data(),
+                              numHeadPartitions, headSize, headScratch.data(), headAccumulator.data(), c.headOutput.data());
+
+            // Current block becomes the previous half of the next frame
+            std::copy(c.headInput.begin() + headSize, c.headInput.end(), c.headInput.begin());
+
+            if (ch == 1)
+            {
+                headPosition = position;
+                headValid = valid;
+            }
+        }
+    }
+
+    // Tail block boundary: the job posted one block ago is due now, then the
+    // block just collected is posted
+    void advanceTail()
+    {
+        if (numTailPartitions == 0)
+            return;
+
+        if (tailBlock > 0)
+        {
+            const int due = (tailBlock - 1) % numSlots;
+            waitForJob(due);
+
+            if (emitSlot >= 0)
+                slots[static_cast<size_t>(emitSlot)].state.store(Free, std::memory_order_relaxed);
+
+            emitSlot = due;
+
+            // Posted before a reset(): computed, but its input is forgotten
+            if (std::exchange(discardPendingJob, false))
+            {
+                slots[static_cast<size_t>(due)].state.store(Free, std::memory_order_relaxed);
+                emitSlot = -1;
+            }
+        }
+
+        auto& slot = slots[static_cast<size_t>(tailBlock % numSlots)];
+        jassert(slot.state.load(std::memory_order_relaxed) == Free);
+
+        for (int ch = 0; ch < 2; ++ch)
+            std::copy(channels[static_cast<size_t>(ch)].tailInput.begin(), channels[static_cast<size_t>(ch)].tailInput.end(),
+                      slot.input[static_cast<size_t>(ch)].begin());
+
+        slot.restart = std::exchange(restartTail, false);
+        slot.state.store(Ready, std::memory_order_release);
+        ++tailBlock;
+        worker->notify();
+    }
+
+    // Audio thread, at each head block boundary inside a tail block: from
+    // halfway on, take over a job no worker has picked up, and compute a
+    // share of its partitions so that it is complete at the deadline
+    void stepLateTailJob()
+    {
+        if (numTailPartitions == 0 || tailBlock == 0)
+            return;
+
+        if (audioSlot < 0)
+        {
+            if (tailFill < tailSize / 2)
+                return;
+
+            const int pending = (tailBlock - 1) % numSlots;
+            auto& slot = slots[static_cast<size_t>(pending)];
+            int expected = Ready;
+
+            if (! slot.state.compare_exchange_strong(expected, Running, std::memory_order_acq_rel))
+                return;  // A worker has it (or it is already done)
+
+            audioSlot = pending;
+            beginTailJob(slot);
+            return;
+        }
+
+        const int blocksLeft = (tailSize - tailFill) / headSize;
+        const int remaining = jobValid - jobPartition;
+        accumulateTailJob((remaining + blocksLeft - 1) / blocksLeft);
+    }
+
+    // Audio thread, at the deadline. A job the audio thread took over is
+    // finished here (the inverse FFTs only); a job a worker is inside is waited
+    // for. Every job is claimed by one or the other halfway to its deadline.
+    void waitForJob(int due)
+    {
+        auto& slot = slots[static_cast<size_t>(due)];
+
+        if (audioSlot == due)
+        {
+            finishTailJob(slot);
+            slot.state.store(Done, std::memory_order_release);
+            audioSlot = -1;
+            return;
+        }
+
+        jassert(slot.state.load(std::memory_order_relaxed) != Ready);
+
+        while (slot.state.load(std::memory_order_acquire) != Done)
+            juce::Thread::yield();
+    }
+
+    // The tail job in three steps, run by whoever owns the slot (state
+    // Running). Jobs run strictly in order, so the tail delay lines and the
+    // job cursor are never touched by two threads at once.
+    //
+    // Begin: forward FFT of the newest frame of each channel into its delay line
+    void beginTailJob(TailSlot& slot)
+    {
+        const int size = spectrumSize(tailSize);
+        jobValid = juce::jmin((slot.restart ? 0 : tailValid) + 1, numTailPartitions);
+        jobPartition = 0;
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            auto& c = channels[static_cast<size_t>(ch)];
+            const auto& input = slot.input[static_cast<size_t>(ch)];
+
+            if (slot.restart)
+                std::fill(c.tailFrame.begin(), c.tailFrame.begin() + tailSize, 0.0f);
+
+            std::copy(input.begin(), input.end(), c.tailFrame.begin() + tailSize);
+            std::copy(c.tailFrame.begin(), c.tailFrame.end(), tailScratch.begin());
+            std::fill(tailScratch.begin() + 2 * tailSize, tailScratch.end(), 0.0f);
+            tailFft.performRealOnlyForwardTransform(tailScratch.data(), true);
+            std::copy(tailScratch.begin(), tailScratch.begin() + size, c.tailSpectra.begin() + tailPosition * size);
+
+            // Current block becomes the previous half of the next frame
+            std::copy(input.begin(), input.end(), c.tailFrame.begin());
+
+            auto& accumulator = tailAccumulators[static_cast<size_t>(ch)];
+            std::fill(accumulator.begin(), accumulator.end(), 0.0f);
+        }
+    }
+
+    // Accumulate the next `count` partition products (the newest frame meets
+    // the first partition)
+    void accumulateTailJob(int count)
+    {
+        const int size = spectrumSize(tailSize);
+        const int end = juce::jmin(jobValid, jobPartition + count);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            const auto& c = channels[static_cast<size_t>(ch)];
+            const auto& k = kernels[static_cast<size_t>(juce::jmin(ch, numIrChannels - 1))];
+            auto* accumulator = tailAccumulators[static_cast<size_t>(ch)].data();
+
+            for (int p = jobPartition; p < end; ++p)
+            {
+                const int frame = (tailPosition - p + numTailPartitions) % numTailPartitions;
+                multiplyAccumulate(accumulator, c.tailSpectra.data() + frame * size, k.tail.data() + p * size, tailSize + 1);
+            }
+        }
+
+        jobPartition = end;
+    }
+
+    // Finish: the remaining partitions, inverse FFTs into the slot outputs,
+    // and advance the delay lines
+    void finishTailJob(TailSlot& slot)
+    {
+        accumulateTailJob(jobValid - jobPartition);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            auto& accumulator = tailAccumulators[static_cast<size_t>(ch)];
+            tailFft.performRealOnlyInverseTransform(accumulator.data());
+            std::copy(accumulator.begin() + tailSize, accumulator.begin() + 2 * tailSize,
+                      slot.output[static_cast<size_t>(ch)].begin());
+        }
+
+        tailValid = jobValid;
+        tailPosition = tailPosition + 1 == numTailPartitions ? 0 : tailPosition + 1;
+    }
+
+    static constexpr int numSlots = 3;  // Being computed, being emitted, and the one freed this boundary
+
+    const int irLength;
+    const int numIrChannels;
+    int numHeadPartitions = 0;
+    int numTailPartitions = 0;
+
+    juce::dsp::FFT headFft { fftOrder(headSize) };
+    juce::dsp::FFT tailFft { fftOrder(tailSize) };
+
+    std::array<Kernel, 2> kernels;
+    std::array<Channel, 2> channels;
+    std::array<TailSlot, numSlots> slots;
+
+    std::vector<float> headScratch, headAccumulator;  // Audio thread
+    std::vector<float> tailScratch;                   // Tail job owner
+    std::array<std::vector<float>, 2> tailAccumulators;
+
+    int headFill = 0, tailFill = 0;
+    int headPosition = 0, tailPosition = 0;
+    int headValid = 0, tailValid = 0;  // Filled delay-line frames (tailValid: job owner)
+    int jobValid = 0, jobPartition = 0;  // Tail job cursor (job owner)
+    int tailBlock = 0;
+    int emitSlot = -1;
+    int audioSlot = -1;  // Tail job taken over by the audio thread
+    bool discardPendingJob = false;
+    bool restartTail = false;
+
+    juce::SharedResourcePointer<ConvolutionWorker> worker;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ConvolutionEngine)
+};
+
+// Worker thread: scan the engines (from a different start per thread) and run
+// the first pending job found, waking another thread first in case there are more
+inline bool ConvolutionWorker::runOneJob(int runnerIndex)
+{
+    const juce::ScopedReadLock sl(lock);
+    const int numEngines = engines.size();
+
+    for (int i = 0; i < numEngines; ++i)
+    {
+        auto* engine = engines.getUnchecked((runnerIndex + i) % numEngines);
+
+        const int claimed = engine->claimTailJob();
+
+        if (claimed >= 0)
+        {
+            if (runners.size() > 1)
+                runners.getUnchecked((runnerIndex + 1) % runners.size())->notify();
+
+            engine->runClaimedTailJob(claimed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Impulse-response reverb: owns the current ConvolutionEngine and handles
+// everything around it.
+//
+//  - loadImpulseResponse() (message thread) decodes, resamples (band-limited
+//    windowed sinc) and normalises the file and builds the new engine on a
+//    background thread, or inline for offline renders; the audio thread only
+//    picks up a finished engine pointer.
+//  - New engines are crossfaded in over crossfadeSeconds, running old and new
+//    side by side (the first one fades in from silence); the retired engine
+//    is freed on the message thread. getLengthSeconds() changes only when the
+//    audio thread has taken the new engine, so it always describes what plays.
+//  - prepare() rebuilds the loaded IR for a new sample rate.
+//
+// IRs are limited to maxSeconds (faded out if longer) and to two channels.
+// Output is wet only, with no latency.
+class PartitionedConvolution : private juce::Timer
+{
+public:
+    static constexpr double maxSeconds = 10.0;
+    static constexpr double crossfadeSeconds = 0.05;
+
+    PartitionedConvolution()
+    {
+        formatManager.registerBasicFormats();
+        startTimer(500);
+    }
+
+    ~PartitionedConvolution() override
+    {
+        stopTimer();
+        loader.removeAllJobs(true, 10000);
+        delete pending.exchange(nullptr);
+        delete retired.exchange(nullptr);
+    }
+
+    // Message thread, audio stopped
+    void prepare(double newSampleRate, int maximumBlockSize)
+    {
+        sampleRate.store(newSampleRate);
+        scratch.setSize(5, maximumBlockSize, false, false, true);  // Crossfade pairs + mono discard
+        fadeLength = juce::jmax(1, static_cast<int>(newSampleRate * crossfadeSeconds));
+        fadePosition = fadeLength;
+
+        const juce::ScopedLock sl(irLock);
+        delete pending.exchange(nullptr);
+        delete retired.exchange(nullptr);
+        fading.reset();
+
+        if (original.getNumSamples() > 0)
+            current = build(original, originalSampleRate, originalTruncated, newSampleRate);
+        else if (current != nullptr)
+            current->reset();
+
+        publishLength();
+    }
+
+    // Message thread. Decoding and the engine build run on a background
+    // thread, or before returning when synchronous (offline renders, so the
+    // first processed block already has the IR).
+    void loadImpulseResponse(const juce::File& file, bool synchronous = false)
+    {
+        loadedFile = file;
+        collectRetired();
+
+        auto job = [this, file]
+        {
+            std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+
+            if (reader == nullptr || reader->lengthInSamples <= 0 || reader->sampleRate <= 0.0)
+                return;
+
+            const auto maxLength = static_cast<juce::int64>(reader->sampleRate * maxSeconds);
+            const auto length = static_cast<int>(juce::jmin(reader->lengthInSamples, maxLength));
+            juce::AudioBuffer<float> ir(juce::jlimit(1, 2, static_cast<int>(reader->numChannels)), length);
+            reader->read(&ir, 0, length, 0, true, ir.getNumChannels() > 1);
+
+            const juce::ScopedLock sl(irLock);
+            original.makeCopyOf(ir);
+            originalSampleRate = reader->sampleRate;
+            originalTruncated = reader->lengthInSamples > maxLength;
+
+            if (auto engine = build(original, originalSampleRate, originalTruncated, sampleRate.load()))
+                delete pending.exchange(engine.release());
+        };
+
+        if (! synchronous)
+        {
+            loader.addJob(std::move(job));
+            return;
+        }
+
+        // Let an earlier background load finish first, so it cannot land after this one
+        loader.removeAllJobs(false, 10000);
+        job();
+    }
+
+    // Any thread: a background load is queued or running
+    bool isLoading() const { return loader.getNumJobs() > 0; }
+
+    // Offline rendering only (blocks): wait for a background load to finish
+    void waitForLoad() const
+    {
+        while (isLoading())
+            juce::Thread::sleep(1);
+    }
+
+    // Audio thread: forget the input so far, e.g. before the convolution is
+    // switched back in after a pause (lock-free, see ConvolutionEngine::reset)
+    void reset()
+    {
+        for (auto* engine : { current.get(), fading.get() })
+            if (engine != nullptr)
+                engine->reset();
+    }
+
+    const juce::File& getFile() const { return loadedFile; }
+
+    // Any thread: length of the IR the audio thread is playing, in seconds (0 = none)
+    double getLengthSeconds() const { return lengthSeconds.load(std::memory_order_relaxed); }
+
+    // Audio thread: take a finished engine, if one is waiting and no
+    // crossfade is running. process() calls this; call it directly while the
+    // output is not needed so getLengthSeconds() still follows a load.
+    void updateEngine()
+    {
+        if (fading != nullptr || fadePosition < fadeLength)
+            return;
+
+        if (auto* next = pending.exchange(nullptr, std::memory_order_acquire))
+        {
+            fading = std::move(current);
+            current.reset(next);
+            fadePosition = 0;
+            publishLength();
+        }
+    }
+
+    // Audio thread. inRight may equal inLeft (mono in); outRight may be null
+    // (mono out, left only). In-place use (out == in) is fine.
+    void process(const float* inLeft, const float* inRight, float* outLeft, float* outRight, int numSamples)
+    {
+        updateEngine();
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, scratch.getNumSamples());
+            processRun(inLeft + done, inRight + done, outLeft + done,
+                       outRight != nullptr ? outRight + done : scratch.getWritePointer(4), count);
+            done += count;
+        }
+    }
+
+private:
+    void processRun(const float* inLeft, const float* inRight, float* outLeft, float* outRight, int n)
+    {
+        const float* in[] { inLeft, inRight };
+
+        if (fading == nullptr && fadePosition >= fadeLength)
+        {
+            if (current == nullptr)
+            {
+                juce::FloatVectorOperations::clear(outLeft, n);
+                juce::FloatVectorOperations::clear(outRight, n);
+                return;
+            }
+
+            float* out[] { outLeft, outRight };
+            current->process(in, out, n);
+            return;
+        }
+
+        // Crossfade: old engine (or silence, for the first IR) into scratch 0/1,
+        // new into 2/3, then a linear blend
+        float* oldOut[] { scratch.getWritePointer(0), scratch.getWritePointer(1) };
+        float* newOut[] { scratch.getWritePointer(2), scratch.getWritePointer(3) };
+
+        if (fading != nullptr)
+            fading->process(in, oldOut, n);
+        else
+            for (auto* channel : oldOut)
+                juce::FloatVectorOperations::clear(channel, n);
+
+        if (current != nullptr)
+            current->process(in, newOut, n);
+        else
+            for (auto* channel : newOut)
+                juce::FloatVectorOperations::clear(channel, n);
+
+        const float step = 1.0f / static_cast<float>(fadeLength);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            float* out = ch == 0 ? outLeft : outRight;
+            float gain = static_cast<float>(fadePosition) * step;
+
+            for (int i = 0; i < n; ++i)
+            {
+                const float g = juce::jmin(1.0f, gain);
+                out[i] = oldOut[ch][i] + g * (newOut[ch][i] - oldOut[ch][i]);
+                gain += step;
+            }
+        }
+
+        fadePosition += n;
+
+        if (fadePosition < fadeLength)
+            return;
+
+        // Done: hand the old engine to the message thread (it frees memory and
+        // unregisters from the worker). If the last one was not collected yet,
+        // keep holding this one and try again next block.
+        fadePosition = fadeLength;
+        auto* expected = static_cast<ConvolutionEngine*>(nullptr);
+
+        if (fading != nullptr && retired.compare_exchange_strong(expected, fading.get(), std::memory_order_acq_rel))
+            fading.release();
+    }
+
+    // Any non-audio thread, irLock held. truncated: the file was longer than
+    // maxSeconds and source holds only its start.
+    static std::unique_ptr<ConvolutionEngine> build(const juce::AudioBuffer<float>& source, double sourceRate,
+                                                    bool truncated, double targetRate)
+    {
+        juce::AudioBuffer<float> ir = resample(source, sourceRate, targetRate);
+        trimAndNormalise(ir, targetRate, truncated);
+
+        if (ir.getNumSamples() == 0)
+            return {};
+
+        return std::make_unique<ConvolutionEngine>(ir);
+    }
+
+    // Audio thread, or message thread with audio stopped (prepare)
+    void publishLength()
+    {
+        const double seconds = current != nullptr ? current->getLength() / sampleRate.load() : 0.0;
+        lengthSeconds.store(seconds, std::memory_order_relaxed);
+    }
+
+    // Windowed-sinc sample-rate conversion. The kernel's cutoff sits just
+    // below the lower of the two Nyquist frequencies and its width scales with
+    // it, so downsampling low-passes at the target Nyquist (no aliasing) and
+    // upsampling does not image. Zero phase: the IR keeps its onset.
+    static juce::AudioBuffer<float> resample(const juce::AudioBuffer<float>& source, double sourceRate, double targetRate)
+    {
+        if (std::abs(sourceRate - targetRate) < 1.0e-6)
+            return source;
+
+        constexpr int zeroCrossings = 32;      // Per side of the kernel
+        constexpr int tableResolution = 256;   // Kernel points per zero crossing (linear in between)
+        constexpr double passband = 0.95;      // Cutoff as a fraction of the lower Nyquist
+
+        const double ratio = sourceRate / targetRate;               // Source samples per output sample
+        const double cutoff = passband * juce::jmin(1.0, 1.0 / ratio);  // Relative to the source Nyquist
+        const double halfWidth = zeroCrossings / cutoff;            // Kernel half-width in source samples
+        const int inLength = source.getNumSamples();
+        const int outLength = static_cast<int>(std::ceil(inLength / ratio));
+
+        // Blackman-windowed sinc over zero crossings 0 .. zeroCrossings
+        std::vector<float> table(static_cast<size_t>(zeroCrossings * tableResolution + 2), 0.0f);
+
+        for (int i = 0; i <= zeroCrossings * tableResolution; ++i)
+        {
+            const double x = static_cast<double>(i) / tableResolution;
+            const double w = x / zeroCrossings;
+            const double window = 0.42 + 0.5 * std::cos(juce::MathConstants<double>::pi * w)
+                                + 0.08 * std::cos(juce::MathConstants<double>::twoPi * w);
+            const double sinc = i == 0 ? 1.0 : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+            table[static_cast<size_t>(i)] = static_cast<float>(cutoff * sinc * window);
+        }
+
+        juce::AudioBuffer<float> result(source.getNumChannels(), outLength);
+        const double tableStep = cutoff * tableResolution;
+
+        for (int ch = 0; ch < source.getNumChannels(); ++ch)
+        {
+            const float* in = source.getReadPointer(ch);
+            float* out = result.getWritePointer(ch);
+
+            for (int j = 0; j < outLength; ++j)
+            {
+                const double t = j * ratio;
+                const int first = juce::jmax(0, static_cast<int>(std::ceil(t - halfWidth)));
+                const int last = juce::jmin(inLength - 1, static_cast<int>(std::floor(t + halfWidth)));
+                float sum = 0.0f;
+
+                for (int k = first; k <= last; ++k)
+                {
+                    const double position = std::abs(t - k) * tableStep;
+                    const auto index = static_cast<size_t>(position);
+                    const auto frac = static_cast<float>(position - static_cast<double>(index));
+                    sum += in[k] * (table[index] + frac * (table[index + 1] - table[index]));
+                }
+
+                out[j] = sum;
+            }
+        }
+
+        return result;
+    }
+
+    // Drop the silent end (below -100 dB of peak), fade out IRs cut at
+    // maxSeconds (here or when the file was read), and scale to unit energy on
+    // the loudest channel so IRs of any length sit at a similar level
+    static void trimAndNormalise(juce::AudioBuffer<float>& ir, double rate, bool truncated)
+    {
+        const float peak = ir.getMagnitude(0, ir.getNumSamples());
+
+        if (peak <= 0.0f)
+        {
+            ir.setSize(ir.getNumChannels(), 0);
+            return;
+        }
+
+        int length = ir.getNumSamples();
+        const float floor = peak * 1.0e-5f;
+
+        while (length > 0)
+        {
+            bool audible = false;
+
+            for (int ch = 0; ch < ir.getNumChannels(); ++ch)
+                audible = audible || std::abs(ir.getSample(ch, length - 1)) > floor;
+
+            if (audible)
+                break;
+
+            --length;
+        }
+
+        const int maxLength = static_cast<int>(rate * maxSeconds);
+
+        // A truncated file still rings where it was cut
+        if (length > maxLength || truncated)
+        {
+            length = juce::jmin(length, maxLength);
+            const int fade = juce::jmin(length, static_cast<int>(rate * 0.01));
+            ir.applyGainRamp(length - fade, fade, 1.0f, 0.0f);
+        }
+
+        ir.setSize(ir.getNumChannels(), length, true);
+
+        float energy = 0.0f;
+
+        for (int ch = 0; ch < ir.getNumChannels(); ++ch)
+        {
+            const float* data = ir.getReadPointer(ch);
+            float channelEnergy = 0.0f;
+
+            for (int i = 0; i < length; ++i)
+                channelEnergy += data[i] * data[i];
+
+            energy = juce::jmax(energy, channelEnergy);
+        }
+
+        ir.applyGain(1.0f / std::sqrt(energy));
+    }
+
+    void collectRetired()
+    {
+        delete retired.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    void timerCallback() override
+    {
+        collectRetired();
+    }
+
+    juce::AudioFormatManager formatManager;
+    juce::ThreadPool loader { 1 };
+    juce::File loadedFile;
+
+    juce::CriticalSection irLock;           // Message thread / loader: original IR and builds
+    juce::AudioBuffer<float> original;
+    double originalSampleRate = 44100.0;
+    bool originalTruncated = false;
+
+    std::atomic<double> sampleRate { 44100.0 };
+    std::atomic<double> lengthSeconds { 0.0 };
+    std::atomic<ConvolutionEngine*> pending { nullptr };  // Built, not yet picked up
+    std::atomic<ConvolutionEngine*> retired { nullptr };  // Faded out, waiting to be freed
+
+    // Audio thread
+    std::unique_ptr<ConvolutionEngine> current, fading;
+    juce::AudioBuffer<float> scratch;
+    int fadeLength = 1;
+    int fadePosition = 1;  // >= fadeLength: no crossfade running
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PartitionedConvolution)
+};
+
+} // namespace pfs
@@ -0,0 +1,163 @@
+#pragma once
+#include "Stft.h"
+#include <cmath>
+#include <vector>
+
+namespace pfs
+{
+
+// Phase-locked phase-vocoder pitch shifter (Laroche & Dolson, "New
+// phase-vocoder techniques for real-time pitch shifting", 1999), on a
+// 2048-point, 4x-overlap Stft.
+//
+// Per frame, spectral peaks are picked and every peak moves together with its
+// region of influence (bins up to halfway to the neighbouring peaks) to the
+// shifted frequency, so each partial keeps its own phase relations (identity
+// phase locking) instead of smearing. The shift is a whole number of bins; the
+// fractional rest, measured from the peak's instantaneous frequency, goes into
+// a per-region phase rotation accumulated from the region that held the peak
+// in the previous frame, which keeps the pitch exact. Bins shifted past
+// Nyquist are dropped. Transcendentals run per peak, not per bin.
+//
+// Latency is getLatencySamples() (2048). Skip process() entirely to bypass,
+// and reset() before resuming so no stale frames play.
+class PhaseVocoderShifter
+{
+public:
+    static constexpr int fftOrder = 11;  // 2048 points
+    static constexpr int overlap = 4;    // Hop = 512
+
+    // Message thread, audio stopped (allocates)
+    void prepare(int newNumChannels)
+    {
+        numChannels = juce::jmax(1, newNumChannels);
+        stft.prepare(fftOrder, overlap, numChannels);
+
+        const auto numBins = static_cast<size_t>(stft.getNumBins());
+        channels.resize(static_cast<size_t>(numChannels));
+
+        for (auto& c : channels)
+        {
+            c.previousSpectrum.assign(2 * numBins, 0.0f);
+            c.rotation.assign(numBins, 0.0f);
+            c.previousRotation.assign(numBins, 0.0f);
+        }
+
+        power.assign(numBins, 0.0f);
+        peaks.assign(numBins, 0);
+        shifted.assign(2 * numBins, 0.0f);
+        reset();
+    }
+
+    void reset()
+    {
+        stft.reset();
+
+        for (auto& c : channels)
+            for (auto* v : { &c.previousSpectrum, &c.rotation, &c.previousRotation })
+                std::fill(v->begin(), v->end(), 0.0f);
+    }
+
+    // Frequency ratio (2 = one octave up); takes effect from the next hop
+    void setRatio(float newRatio) { ratio = juce::jlimit(0.25f, 4.0f, newRatio); }
+
+    int getLatencySamples() const { return stft.getLatencySamples(); }
+
+    // Audio thread. output may alias input.
+    void process(const float* const* input, float* const* output, int numSamples)
+    {
+        stft.process(input, output, numSamples, [this](int channel, float* spectrum) { shiftFrame(channel, spectrum); });
+    }
+
+private:
+    struct Channel
+    {
+        std::vector<float> previousSpectrum;  // Last analysis frame (phase differences)
+        std::vector<float> rotation;          // Phase rotation of the region each bin fell in
+        std::vector<float> previousRotation;
+    };
+
+    void shiftFrame(int channel, float* spectrum)
+    {
+        constexpr float twoPi = juce::MathConstants<float>::twoPi;
+        auto& c = channels[static_cast<size_t>(channel)];
+        const int numBins = stft.getNumBins();
+        const float hop = static_cast<float>(stft.getHopSize());
+        const float binToPhaseAdvance = twoPi * hop / static_cast<float>(stft.getFftSize());
+
+        for (int k = 0; k < numBins; ++k)
+            power[static_cast<size_t>(k)] = spectrum[2 * k] * spectrum[2 * k] + spectrum[2 * k + 1] * spectrum[2 * k + 1];
+
+        // Local maxima over +-2 bins, ignoring bins more than 100 dB below the frame peak
+        float loudest = 0.0f;
+
+        for (int k = 0; k < numBins; ++k)
+            loudest = juce::jmax(loudest, power[static_cast<size_t>(k)]);
+
+        const float floor = loudest * 1.0e-10f;
+        int numPeaks = 0;
+
+        for (int k = 2; k < numBins - 2; ++k)
+        {
+            const float* p = power.data() + k;
+
+            if (p[0] > floor && p[0] > p[-1] && p[0] >= p[1] && p[0] > p[-2] && p[0] >= p[2])
+                peaks[static_cast<size_t>(numPeaks++)] = k;
+        }
+
+        std::fill(shifted.begin(), shifted.end(), 0.0f);
+        std::swap(c.rotation, c.previousRotation);
+
+        for (int n = 0; n < numPeaks; ++n)
+        {
+            const int peak = peaks[static_cast<size_t>(n)];
+            const int start = n == 0 ? 0 : (peaks[static_cast<size_t>(n - 1)] + peak + 1) / 2;
+            const int end = n + 1 == numPeaks ? numBins : (peak + peaks[static_cast<size_t>(n + 1)] + 1) / 2;
+
+            // Instantaneous frequency of the peak in bins, from the phase
+            // advance since the previous frame
+            const float phase = std::atan2(spectrum[2 * peak + 1], spectrum[2 * peak]);
+            const float previousPhase = std::atan2(c.previousSpectrum[static_cast<size_t>(2 * peak + 1)],
+                                                   c.previousSpectrum[static_cast<size_t>(2 * peak)]);
+            const float deviation = std::remainder(phase - previousPhase - binToPhaseAdvance * static_cast<float>(peak), twoPi);
+            const float frequency = static_cast<float>(peak) + deviation / binToPhaseAdvance;
+
+            const float shift = (ratio - 1.0f) * frequency;
+            const int binShift = static_cast<int>(std::lround(shift));
+            const float rotation = std::remainder(c.previousRotation[static_cast<size_t>(peak)] + binToPhaseAdvance * shift, twoPi);
+            const float cosine = std::cos(rotation);
+            const float sine = std::sin(rotation);
+
+            const int first = juce::jmax(start, -binShift);
+            const int last = juce::jmin(end, numBins - binShift);
+
+            for (int k = first; k < last; ++k)
+            {
+                const float re = spectrum[2 * k];
+                const float im = spectrum[2 * k + 1];
+                float* target = shifted.data() + 2 * (k + binShift);
+                target[0] += re * cosine - im * sine;
+                target[1] += re * sine + im * cosine;
+            }
+
+            std::fill(c.rotation.begin() + start, c.rotation.begin() + end, rotation);
+        }
+
+        if (numPeaks == 0)
+            std::fill(c.rotation.begin(), c.rotation.end(), 0.0f);
+
+        std::copy(spectrum, spectrum + 2 * numBins, c.previousSpectrum.begin());
+        std::copy(shifted.begin(), shifted.end(), spectrum);
+    }
+
+    Stft stft;
+    int numChannels = 0;
+    float ratio = 2.0f;
+
+    std::vector<Channel> channels;
+    std::vector<float> power;    // Scratch: |X|^2 per bin
+    std::vector<int> peaks;      // Scratch: peak bins, ascending
+    std::vector<float> shifted;  // Scratch: output spectrum
+};
+
+} // namespace pfs
@@ -0,0 +1,130 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+
+namespace pfs
+{
+
+// Idle/silence bookkeeping shared by the instruments (and effect tails).
+//
+// A processor is idle when no voice is sounding, no note-on arrives in the
+// block and any tail it owns (reverb etc.) has decayed below the threshold
+// for at least the hold time. Idle blocks are cleared with
+// AudioBuffer::clear(), which sets the buffer's "is clear" flag that plugin
+// wrappers use as a silence hint; nothing may call getWritePointer() on the
+// buffer afterwards or the flag is dropped.
+//
+// Typical use in processBlock():
+//
+//     if (silence.isIdle(anyVoiceActive(), midiMessages))
+//     {
+//         pfs::SilenceTracker::outputSilence(buffer);
+//         return;
+//     }
+//
+//     ... render voices / tail ...
+//
+//     silence.trackTail(buffer, anyVoiceActive());
+//     if (silence.tailJustEnded()) reverb.reset();
+//
+// Effects use the input as the source: check ! isBelowThreshold(buffer)
+// before processing and pass that for anyVoiceActive().
+class SilenceTracker
+{
+public:
+    void prepare(double sampleRate, double holdSeconds = 0.1, float thresholdDecibels = -100.0f)
+    {
+        holdSamples = juce::jmax(1, static_cast<int>(sampleRate * holdSeconds));
+        threshold = juce::Decibels::decibelsToGain(thresholdDecibels);
+        reset();
+    }
+
+    // Assume sound until proven otherwise (e.g. after prepareToPlay or a state change)
+    void reset()
+    {
+        silentSamples = 0;
+        tailSilent = false;
+        tailEnded = false;
+    }
+
+    static bool containsNoteOn(const juce::MidiBuffer& midiMessages)
+    {
+        for (const auto metadata : midiMessages)
+            if (metadata.getMessage().isNoteOn())
+                return true;
+
+        return false;
+    }
+
+    // True when this block can be skipped entirely
+    bool isIdle(bool anyVoiceActive, const juce::MidiBuffer& midiMessages) const
+    {
+        return ! anyVoiceActive && tailSilent && ! containsNoteOn(midiMessages);
+    }
+
+    // Feed the processed block. While a source (voice/input) is active the tail
+    // is considered running; afterwards the output peak must stay below the
+    // threshold for the hold time before the tail counts as finished.
+    void trackTail(const juce::AudioBuffer<float>& buffer, bool sourceActive)
+    {
+        tailEnded = false;
+
+        if (sourceActive)
+        {
+            silentSamples = 0;
+            tailSilent = false;
+            return;
+        }
+
+        if (tailSilent)
+            return;
+
+        const int numSamples = buffer.getNumSamples();
+
+        if (buffer.hasBeenCleared() || getPeak(buffer, numSamples) < threshold)
+            silentSamples += numSamples;
+        else
+            silentSamples = 0;
+
+        if (silentSamples >= holdSamples)
+        {
+            tailSilent = true;
+            tailEnded = true;
+        }
+    }
+
+    bool isTailSilent() const { return tailSilent; }
+
+    // Effects: is this (input) block below the threshold? Pass the negation as
+    // the source-active flag to isIdle() / trackTail().
+    bool isBelowThreshold(const juce::AudioBuffer<float>& buffer) const
+    {
+        return buffer.hasBeenCleared() || getPeak(buffer, buffer.getNumSamples()) < threshold;
+    }
+
+    // True only for the block in which the tail fell silent (reset reverb state etc.)
+    bool tailJustEnded() const { return tailEnded; }
+
+    static void outputSilence(juce::AudioBuffer<float>& buffer)
+    {
+        buffer.clear();
+    }
+
+private:
+    static float getPeak(const juce::AudioBuffer<float>& buffer, int numSamples)
+    {
+        float peak = 0.0f;
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            peak = juce::jmax(peak, buffer.getMagnitude(channel, 0, numSamples));
+
+        return peak;
+    }
+
+    int holdSamples = 4410;
+    int silentSamples = 0;
+    float threshold = 1.0e-5f;
+    bool tailSilent = false;
+    bool tailEnded = false;
+};
+
+} // namespace pfs
@@ -0,0 +1,142 @@
+#pragma once
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace pfs
+{
+
+// Streaming short-time Fourier transform with weighted overlap-add
+// resynthesis, for spectral effects that work frame by frame.
+//
+// Each channel keeps the last fftSize inputs and an overlap-add accumulator.
+// Every hop (fftSize / overlap samples) a frame is Hann-windowed, transformed,
+// handed to the caller's frame processor, transformed back, windowed again and
+// added into the accumulator. All FFT work happens at hop boundaries, so the
+// cost per hop is fixed whatever the host block size; in between, a block only
+// copies samples. Window and overlap-add use juce::FloatVectorOperations.
+//
+// Latency is exactly fftSize samples. With the processor leaving the spectrum
+// untouched the output is the input delayed by getLatencySamples().
+//
+// Spectra use JUCE's real-only layout: getNumBins() = fftSize / 2 + 1
+// interleaved complex bins (re, im), DC first.
+class Stft
+{
+public:
+    // Message thread, audio stopped (allocates). overlap: a power of two, at
+    // least 4 so the squared Hann windows sum flat.
+    void prepare(int newFftOrder, int newOverlap, int newNumChannels)
+    {
+        fftSize = 1 << newFftOrder;
+        hopSize = fftSize / juce::jmax(4, newOverlap);
+        numChannels = juce::jmax(1, newNumChannels);
+        fft = std::make_unique<juce::dsp::FFT>(newFftOrder);
+
+        // Periodic Hann for analysis and synthesis. Their overlapped product
+        // sums to sum(w^2) / hop at every sample; the synthesis window
+        // carries the inverse so the round trip has unity gain.
+        window.resize(static_cast<size_t>(fftSize));
+        synthesisWindow.resize(static_cast<size_t>(fftSize));
+
+        double sum = 0.0;
+
+        for (int i = 0; i < fftSize; ++i)
+        {
+            const double w = 0.5 * (1.0 - std::cos(juce::MathConstants<double>::twoPi * i / fftSize));
+            window[static_cast<size_t>(i)] = static_cast<float>(w);
+            sum += w * w;
+        }
+
+        const float gain = static_cast<float>(hopSize / sum);
+
+        for (int i = 0; i < fftSize; ++i)
+            synthesisWindow[static_cast<size_t>(i)] = window[static_cast<size_t>(i)] * gain;
+
+        inputFrames.assign(static_cast<size_t>(numChannels * fftSize), 0.0f);
+        outputFrames.assign(static_cast<size_t>(numChannels * fftSize), 0.0f);
+        frame.assign(static_cast<size_t>(2 * fftSize), 0.0f);
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(inputFrames.begin(), inputFrames.end(), 0.0f);
+        std::fill(outputFrames.begin(), outputFrames.end(), 0.0f);
+        hopFill = 0;
+    }
+
+    int getFftSize() const { return fftSize; }
+    int getHopSize() const { return hopSize; }
+    int getNumBins() const { return fftSize / 2 + 1; }
+    int getLatencySamples() const { return fftSize; }
+
+    // Audio thread. processFrame(int channel, float* spectrum) edits one
+    // channel's spectrum in place. output may alias input.
+    template <typename FrameProcessor>
+    void process(const float* const* input, float* const* output, int numSamples, FrameProcessor&& processFrame)
+    {
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, hopSize - hopFill);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                float* in = inputFrames.data() + ch * fftSize;
+                const float* out = outputFrames.data() + ch * fftSize;
+
+                // Newest hop fills the end of the frame; the accumulator's
+                // head is complete (every frame covering it has been added)
+                juce::FloatVectorOperations::copy(in + fftSize - hopSize + hopFill, input[ch] + done, count);
+                juce::FloatVectorOperations::copy(output[ch] + done, out + hopFill, count);
+            }
+
+            done += count;
+            hopFill += count;
+
+            if (hopFill == hopSize)
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                    processHop(ch, processFrame);
+
+                hopFill = 0;
+            }
+        }
+    }
+
+private:
+    template <typename FrameProcessor>
+    void processHop(int channel, FrameProcessor& processFrame)
+    {
+        float* in = inputFrames.data() + channel * fftSize;
+        float* out = outputFrames.data() + channel * fftSize;
+        const int keep = fftSize - hopSize;
+
+        juce::FloatVectorOperations::multiply(frame.data(), in, window.data(), fftSize);
+        fft->performRealOnlyForwardTransform(frame.data(), true);
+        processFrame(channel, frame.data());
+        fft->performRealOnlyInverseTransform(frame.data());
+
+        // Emitted hop out, new frame in (overlapping shifts: std::copy, not memcpy)
+        std::copy(out + hopSize, out + fftSize, out);
+        juce::FloatVectorOperations::clear(out + keep, hopSize);
+        juce::FloatVectorOperations::addWithMultiply(out, frame.data(), synthesisWindow.data(), fftSize);
+
+        std::copy(in + hopSize, in + fftSize, in);
+    }
+
+    int fftSize = 0;
+    int hopSize = 0;
+    int numChannels = 0;
+    int hopFill = 0;
+
+    std::unique_ptr<juce::dsp::FFT> fft;
+    std::vector<float> window, synthesisWindow;
+    std::vector<float> inputFrames;   // Per channel: last fftSize inputs
+    std::vector<float> outputFrames;  // Per channel: overlap-add accumulator, head = current hop
+    std::vector<float> frame;         // FFT work buffer (2 * fftSize)
+};
+
+} // namespace pfs
@@ -0,0 +1,437 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace pfs
+{
+
+// Real-time safe diagnostics shared by all plugins.
+//
+// Producers (any thread, including the audio thread) write fixed-size events
+// into a preallocated lock-free ring: a timestamp, a static name and two
+// numeric payloads. Nothing is formatted, allocated or written to disk on the
+// calling thread; when the ring is full the event is dropped and counted.
+// A TraceWriter thread drains the ring, formats the events and appends them to
+// a rotating log file. Everything is a relaxed-load no-op until tracing is
+// enabled, either at runtime through Trace::setEnabled() or by starting the
+// host with PFS_TRACE=1 (log) or PFS_TRACE=profile (log + per-block timing
+// exported as Chrome trace JSON, viewable in Perfetto or chrome://tracing).
+//
+//     juce::SharedResourcePointer<pfs::TraceWriter> traceWriter;    // processor member
+//
+//     pfs::TraceScope blockTrace ("Sektor::processBlock", numSamples); // audio thread
+//     pfs::Trace::instant ("Sektor.grain", grainSizeMs, density);      // audio thread
+//     pfs::Trace::message ("Sektor", "Loaded " + file.getFileName());  // message thread
+//
+// Event names must be string literals (only the pointer is stored).
+class Trace
+{
+public:
+    static constexpr int ringSize = 4096;     // Events (power of two)
+    static constexpr int textCapacity = 96;   // Bytes of message text, including the terminator
+
+    enum class Phase : char { Instant, Complete, Message };
+
+    struct Event
+    {
+        juce::int64 ticks = 0;          // High-resolution start time
+        juce::int64 durationTicks = 0;  // Complete events only
+        const char* name = "";
+        double values[2] {};
+        std::uint64_t threadId = 0;
+        Phase phase = Phase::Instant;
+        char text[textCapacity] {};     // Message events only
+    };
+
+    static bool isEnabled() noexcept   { return state().enabled.load(std::memory_order_relaxed); }
+    static bool isProfiling() noexcept { return state().profiling.load(std::memory_order_relaxed); }
+
+    // Message thread. The ring is initialised on first enable, before producers can see it.
+    static void setEnabled(bool shouldBeEnabled, bool withProfiling = false)
+    {
+        auto& s = state();
+
+        if (shouldBeEnabled && ! s.initialised)
+        {
+            for (size_t i = 0; i < static_cast<size_t>(ringSize); ++i)
+                s.cells[i].sequence.store(i, std::memory_order_relaxed);
+
+            s.initialised = true;
+        }
+
+        s.profiling.store(shouldBeEnabled && withProfiling, std::memory_order_relaxed);
+        s.enabled.store(shouldBeEnabled, std::memory_order_release);
+    }
+
+    // Audio-thread safe: point event with two numeric payloads
+    static void instant(const char* name, double value0 = 0.0, double value1 = 0.0) noexcept
+    {
+        if (! isEnabled())
+            return;
+
+        push([&](Event& e)
+        {
+            e.ticks = juce::Time::getHighResolutionTicks();
+            e.durationTicks = 0;
+            e.name = name;
+            e.values[0] = value0;
+            e.values[1] = value1;
+            e.phase = Phase::Instant;
+            e.text[0] = 0;
+        });
+    }
+
+    // Audio-thread safe: timed span (recorded only while profiling)
+    static void complete(const char* name, juce::int64 startTicks, juce::int64 endTicks, double value0 = 0.0) noexcept
+    {
+        if (! isProfiling())
+            return;
+
+        push([&](Event& e)
+        {
+            e.ticks = startTicks;
+            e.durationTicks = endTicks - startTicks;
+            e.name = name;
+            e.values[0] = value0;
+            e.values[1] = 0.0;
+            e.phase = Phase::Complete;
+            e.text[0] = 0;
+        });
+    }
+
+    // Free text from non-realtime threads (the caller builds the string);
+    // truncated to textCapacity - 1 bytes
+    static void message(const char* name, const juce::String& text)
+    {
+        if (! isEnabled())
+            return;
+
+        push([&](Event& e)
+        {
+            e.ticks = juce::Time::getHighResolutionTicks();
+            e.durationTicks = 0;
+            e.name = name;
+            e.values[0] = e.values[1] = 0.0;
+            e.phase = Phase::Message;
+            text.copyToUTF8(e.text, textCapacity);
+        });
+    }
+
+    // Consumer side (TraceWriter thread only)
+    static bool pop(Event& destination) noexcept
+    {
+        auto& s = state();
+        auto& cell = s.cells[s.dequeuePosition & (ringSize - 1)];
+
+        if (cell.sequence.load(std::memory_order_acquire) != s.dequeuePosition + 1)
+            return false;
+
+        destination = cell.event;
+        cell.sequence.store(s.dequeuePosition + ringSize, std::memory_order_release);
+        ++s.dequeuePosition;
+        return true;
+    }
+
+    static std::uint32_t takeDroppedCount() noexcept { return state().dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence { 0 };
+        Event event;
+    };
+
+    struct State
+    {
+        std::atomic<bool> enabled { false };
+        std::atomic<bool> profiling { false };
+        bool initialised = false;
+        alignas(64) std::atomic<size_t> enqueuePosition { 0 };
+        alignas(64) size_t dequeuePosition = 0;
+        std::atomic<std::uint32_t> dropped { 0 };
+        Cell cells[ringSize];
+    };
+
+    // Static storage: no allocation, nothing to construct on the audio thread
+    static State& state() noexcept
+    {
+        static State s;
+        return s;
+    }
+
+    // Bounded multi-producer ring (per-cell sequence numbers, Vyukov style)
+    template <typename Fill>
+    static void push(Fill&& fill) noexcept
+    {
+        auto& s = state();
+        auto position = s.enqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& cell = s.cells[position & (ringSize - 1)];
+            const auto sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0)
+            {
+                if (s.enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    fill(cell.event);
+                    cell.event.threadId = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(juce::Thread::getCurrentThreadId()));
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+            }
+            else if (difference < 0)
+            {
+                s.dropped.fetch_add(1, std::memory_order_relaxed);  // Full: the writer is behind
+                return;
+            }
+            else
+            {
+                position = s.enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+// RAII block timer: one Complete event per scope while profiling
+class TraceScope
+{
+public:
+    TraceScope(const char* nameToUse, int numSamplesToRecord) noexcept
+        : name(nameToUse),
+          numSamples(numSamplesToRecord),
+          startTicks(Trace::isProfiling() ? juce::Time::getHighResolutionTicks() : 0)
+    {
+    }
+
+    ~TraceScope()
+    {
+        if (startTicks != 0)
+            Trace::complete(name, startTicks, juce::Time::getHighResolutionTicks(), numSamples);
+    }
+
+private:
+    const char* name;
+    int numSamples;
+    juce::int64 startTicks;
+
+    JUCE_DECLARE_NON_COPYABLE(TraceScope)
+};
+
+// Background consumer. Hold one through juce::SharedResourcePointer in each
+// processor; the thread runs while any instance of the plugin is alive.
+//
+// Files go to <system log folder>/PluginFreedomSystem/:
+//   <Plugin>.log (rotated to <Plugin>.1.log .. <Plugin>.3.log at 2 MB)
+//   <Plugin>-<time>.json when profiling
+class TraceWriter : private juce::Thread
+{
+public:
+    TraceWriter() : juce::Thread("pfs trace writer")
+    {
+        const auto mode = juce::SystemStats::getEnvironmentVariable("PFS_TRACE", {});
+
+        if (mode.isNotEmpty() && mode != "0")
+            Trace::setEnabled(true, mode.equalsIgnoreCase("profile"));
+
+        startThread(juce::Thread::Priority::low);
+    }
+
+    ~TraceWriter() override
+    {
+        stopThread(2000);
+    }
+
+    static juce::File getLogDirectory()
+    {
+        return juce::FileLogger::getSystemLogFileFolder().getChildFile("PluginFreedomSystem");
+    }
+
+private:
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            wait(100);
+            drain();
+        }
+
+        drain();
+        closeProfile();
+    }
+
+    void drain()
+    {
+        Trace::Event event;
+
+        while (Trace::pop(event))
+        {
+            if (event.phase != Trace::Phase::Complete)
+                writeLogLine(event);
+
+            if (Trace::isProfiling() || profile != nullptr)
+                writeProfileEvent(event);
+        }
+
+        if (const auto dropped = Trace::takeDroppedCount(); dropped > 0)
+            writeLogText("trace: " + juce::String(dropped) + " events dropped (ring full)");
+
+        if (log != nullptr)
+            log->flush();
+
+        if (profile != nullptr)
+            profile->flush();
+    }
+
+    double secondsSinceStart(juce::int64 ticks) const
+    {
+        return juce::Time::highResolutionTicksToSeconds(ticks - startTicks);
+    }
+
+    int threadIndex(std::uint64_t threadId)
+    {
+        const auto index = threadIds.indexOf(static_cast<juce::int64>(threadId));
+
+        if (index >= 0)
+            return index + 1;
+
+        threadIds.add(static_cast<juce::int64>(threadId));
+        return threadIds.size();
+    }
+
+    void writeLogLine(const Trace::Event& event)
+    {
+        juce::String line;
+        line << juce::String(secondsSinceStart(event.ticks), 6) << " [" << threadIndex(event.threadId) << "] " << event.name;
+
+        if (event.phase == Trace::Phase::Message)
+            line << ": " << juce::String::fromUTF8(event.text);
+        else
+            line << " " << event.values[0] << " " << event.values[1];
+
+        writeLogText(line);
+    }
+
+    void writeLogText(const juce::String& line)
+    {
+        if (log == nullptr || log->getPosition() > maxLogBytes)
+            openLog();
+
+        if (log != nullptr)
+            *log << line << juce::newLine;
+    }
+
+    void openLog()
+    {
+        log.reset();
+
+        const auto directory = getLogDirectory();
+        directory.createDirectory();
+        const auto file = directory.getChildFile(pluginName() + ".log");
+
+        // Rotate: Plugin.2.log -> Plugin.3.log, ..., Plugin.log -> Plugin.1.log
+        if (file.existsAsFile() && file.getSize() > maxLogBytes)
+        {
+            for (int i = numRotatedLogs - 1; i >= 1; --i)
+            {
+                const auto older = directory.getChildFile(pluginName() + "." + juce::String(i) + ".log");
+
+                if (older.existsAsFile())
+                    older.moveFileTo(directory.getChildFile(pluginName() + "." + juce::String(i + 1) + ".log"));
+            }
+
+            file.moveFileTo(directory.getChildFile(pluginName() + ".1.log"));
+        }
+
+        auto stream = std::make_unique<juce::FileOutputStream>(file);
+
+        if (stream->openedOk())
+            log = std::move(stream);
+    }
+
+    void writeProfileEvent(const Trace::Event& event)
+    {
+        if (profile == nullptr && ! openProfile())
+            return;
+
+        auto* object = new juce::DynamicObject();
+        object->setProperty("name", juce::String::fromUTF8(event.name));
+        object->setProperty("pid", 1);
+        object->setProperty("tid", threadIndex(event.threadId));
+        object->setProperty("ts", secondsSinceStart(event.ticks) * 1.0e6);
+
+        auto* args = new juce::DynamicObject();
+
+        if (event.phase == Trace::Phase::Complete)
+        {
+            object->setProperty("ph", "X");
+            object->setProperty("dur", juce::Time::highResolutionTicksToSeconds(event.durationTicks) * 1.0e6);
+            args->setProperty("samples", event.values[0]);
+        }
+        else
+        {
+            object->setProperty("ph", "i");
+            object->setProperty("s", "t");
+
+            if (event.phase == Trace::Phase::Message)
+            {
+                args->setProperty("text", juce::String::fromUTF8(event.text));
+            }
+            else
+            {
+                args->setProperty("value0", event.values[0]);
+                args->setProperty("value1", event.values[1]);
+            }
+        }
+
+        object->setProperty("args", juce::var(args));
+        *profile << ",\n" << juce::JSON::toString(juce::var(object), true);
+    }
+
+    // JSON array format; the closing bracket is optional for trace viewers, so
+    // a crashed session still loads
+    bool openProfile()
+    {
+        const auto directory = getLogDirectory();
+        directory.createDirectory();
+        const auto file = directory.getChildFile(pluginName() + "-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S") + ".json");
+
+        auto stream = std::make_unique<juce::FileOutputStream>(file);
+
+        if (! stream->openedOk())
+            return false;
+
+        profile = std::move(stream);
+        *profile << "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"" << pluginName() << "\"}}";
+        return true;
+    }
+
+    void closeProfile()
+    {
+        if (profile != nullptr)
+            *profile << "\n]\n";
+
+        profile.reset();
+    }
+
+    static juce::String pluginName()
+    {
+        return juce::File::getSpecialLocation(juce::File::currentExecutableFile).getFileNameWithoutExtension();
+    }
+
+    static constexpr juce::int64 maxLogBytes = 2 * 1024 * 1024;
+    static constexpr int numRotatedLogs = 3;
+
+    const juce::int64 startTicks = juce::Time::getHighResolutionTicks();
+    juce::Array<juce::int64> threadIds;
+    std::unique_ptr<juce::FileOutputStream> log;
+    std::unique_ptr<juce::FileOutputStream> profile;
+
+    JUCE_DECLARE_NON_COPYABLE(TraceWriter)
+};
+
+} // namespace pfs
@@ -0,0 +1,178 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace pfs
+{
+
+// 4x true-peak interpolator (ITU-R BS.1770-4 Annex 2): a 48-tap polyphase
+// FIR, Kaiser-windowed sinc with 12 taps per phase, each phase normalised to
+// unity gain at DC. Phase 0 is the input sample itself (delayed by taps / 2);
+// phases 1-3 fall a quarter, half and three quarters of a sample later.
+struct TruePeakKernel
+{
+    static constexpr int taps = 12;
+    static constexpr int phases = 4;
+    static constexpr int delaySamples = taps / 2;
+    using Table = std::array<std::array<float, taps>, phases>;
+
+    static const Table& get()
+    {
+        static const Table table = make();
+        return table;
+    }
+
+    // history holds taps - 1 older samples followed by numSamples new ones;
+    // out[i] is the value delaySamples - phase / 4 samples before new sample i.
+    // Runs tap by tap over the block, so it vectorises.
+    static void interpolate(const float* history, int numSamples, int phase, float* out)
+    {
+        const auto& kernel = get()[static_cast<size_t>(phase)];
+        std::fill(out, out + numSamples, 0.0f);
+
+        for (int k = 0; k < taps; ++k)
+        {
+            const float tap = kernel[static_cast<size_t>(k)];
+            const float* source = history + (taps - 1 - k);
+
+            for (int i = 0; i < numSamples; ++i)
+                out[i] += tap * source[i];
+        }
+    }
+
+private:
+    static Table make()
+    {
+        constexpr double pi = juce::MathConstants<double>::pi;
+        constexpr double beta = 5.0;
+        constexpr double halfWidth = taps / 2;
+        const auto besselI0 = [](double x)
+        {
+            double sum = 1.0, term = 1.0;
+
+            for (int k = 1; k < 30; ++k)
+            {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+
+            return sum;
+        };
+
+        Table table {};
+
+        for (int phase = 0; phase < phases; ++phase)
+        {
+            std::array<double, taps> h {};
+            double sum = 0.0;
+
+            for (int k = 0; k < taps; ++k)
+            {
+                const double t = k - halfWidth + phase / static_cast<double>(phases);
+                const double sinc = std::abs(t) < 1.0e-9 ? 1.0 : std::sin(pi * t) / (pi * t);
+                const double r = t / halfWidth;
+                const double window = std::abs(r) < 1.0 ? besselI0(beta * std::sqrt(1.0 - r * r)) / besselI0(beta) : 0.0;
+                h[static_cast<size_t>(k)] = sinc * window;
+                sum += h[static_cast<size_t>(k)];
+            }
+
+            for (int k = 0; k < taps; ++k)
+                table[static_cast<size_t>(phase)][static_cast<size_t>(k)] = static_cast<float>(h[static_cast<size_t>(k)] / sum);
+        }
+
+        return table;
+    }
+};
+
+// Per-sample true-peak level for limiter detection, stereo-linked.
+//
+// Delays the audio in place by TruePeakKernel::delaySamples and writes, for
+// each delayed sample, the largest |value| of the 4x-interpolated signal from
+// one sample before it to one sample after it (both neighbouring segments).
+// A gain of ceiling / level held across a sample's neighbourhood therefore
+// keeps the true peak (as metered by pfs::LevelMeter, same kernel) at or
+// under the ceiling.
+class TruePeakDetector
+{
+public:
+    static constexpr int delaySamples = TruePeakKernel::delaySamples;
+
+    // Message thread, audio stopped (allocates)
+    void prepare(int numChannels)
+    {
+        channels.resize(static_cast<size_t>(juce::jmax(1, numChannels)));
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& c : channels)
+            c = {};
+    }
+
+    // Audio thread, in place
+    void process(float* const* data, int numChannels, int numSamples, float* levels)
+    {
+        numChannels = juce::jmin(numChannels, static_cast<int>(channels.size()));
+        std::fill(levels, levels + numSamples, 0.0f);
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(numSamples - done, chunkSize);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                processChunk(channels[static_cast<size_t>(ch)], data[ch] + done, count, levels + done);
+
+            done += count;
+        }
+    }
+
+private:
+    static constexpr int chunkSize = 64;
+    static constexpr int historySize = TruePeakKernel::taps - 1;
+
+    struct Channel
+    {
+        std::array<float, historySize + chunkSize> history {};  // Previous taps + current chunk
+        float previousSegment = 0.0f;                           // Segment peak ending at the next delayed sample
+    };
+
+    static void processChunk(Channel& c, float* samples, int count, float* levels)
+    {
+        float* buffer = c.history.data();
+        std::copy(samples, samples + count, buffer + historySize);
+
+        // segment[i]: peak of the interpolated values between delayed sample
+        // i and the one after it
+        std::array<float, chunkSize> segment {}, phase {};
+
+        for (int p = 1; p < TruePeakKernel::phases; ++p)
+        {
+            TruePeakKernel::interpolate(buffer, count, p, phase.data());
+
+            for (int i = 0; i < count; ++i)
+                segment[static_cast<size_t>(i)] = juce::jmax(segment[static_cast<size_t>(i)], std::abs(phase[static_cast<size_t>(i)]));
+        }
+
+        // Delayed output sample i = history index i + historySize - delaySamples
+        const float* delayed = buffer + historySize - delaySamples;
+
+        for (int i = 0; i < count; ++i)
+        {
+            const float before = i == 0 ? c.previousSegment : segment[static_cast<size_t>(i - 1)];
+            const float level = juce::jmax(std::abs(delayed[i]), before, segment[static_cast<size_t>(i)]);
+            levels[i] = juce::jmax(levels[i], level);
+        }
+
+        c.previousSegment = segment[static_cast<size_t>(count - 1)];
+        std::copy(delayed, delayed + count, samples);
+        std::copy(buffer + count, buffer + count + historySize, buffer);
+    }
+
+    std::vector<Channel> channels;
+};
+
+} // namespace pfs
@@ -0,0 +1,107 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cmath>
+
+namespace pfs
+{
+
+// Grain envelope shapes, in parameter-choice order
+enum class WindowShape { Hann, Tukey, Blackman, Gaussian, Trapezoid };
+
+// Immutable grain window bank shared by the granular plugins.
+//
+// Every shape is tabulated once at a fixed resolution over phase 0..1 (both
+// ends included, so a grain of any length reads the same table with a phase
+// increment of 1 / grainSize). The bank is a function-local static with no
+// heap storage; call WindowTables::get() from a constructor so the one-time
+// build never lands on the audio thread.
+class WindowTables
+{
+public:
+    static constexpr int numShapes = 5;
+    static constexpr int resolution = 4096;  // Table intervals (resolution + 1 points)
+
+    static const WindowTables& get()
+    {
+        static const WindowTables bank;
+        return bank;
+    }
+
+    // Linear-interpolated window value at phase in [0, 1] (clamped)
+    float lookup(WindowShape shape, float phase) const
+    {
+        const float* table = tables[static_cast<size_t>(shape)].data();
+        const float position = juce::jlimit(0.0f, 1.0f, phase) * static_cast<float>(resolution);
+        const int index = juce::jmin(resolution - 1, static_cast<int>(position));
+        const float frac = position - static_cast<float>(index);
+        return table[index] + frac * (table[index + 1] - table[index]);
+    }
+
+    // dest[i] = window(startPhase + i * increment)
+    void fill(WindowShape shape, float startPhase, float increment, float* dest, int numSamples) const
+    {
+        const float* table = tables[static_cast<size_t>(shape)].data();
+        const float scale = static_cast<float>(resolution);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float phase = juce::jlimit(0.0f, 1.0f, startPhase + static_cast<float>(i) * increment);
+            const float position = phase * scale;
+            const int index = juce::jmin(resolution - 1, static_cast<int>(position));
+            const float frac = position - static_cast<float>(index);
+            dest[i] = table[index] + frac * (table[index + 1] - table[index]);
+        }
+    }
+
+private:
+    WindowTables()
+    {
+        for (int shape = 0; shape < numShapes; ++shape)
+            for (int i = 0; i <= resolution; ++i)
+                tables[static_cast<size_t>(shape)][static_cast<size_t>(i)]
+                    = static_cast<float>(evaluate(static_cast<WindowShape>(shape), static_cast<double>(i) / resolution));
+    }
+
+    static double evaluate(WindowShape shape, double x)
+    {
+        constexpr double twoPi = juce::MathConstants<double>::twoPi;
+
+        switch (shape)
+        {
+            case WindowShape::Tukey:
+            {
+                // Flat top with cosine tapers over the outer 25% on each side (alpha = 0.5)
+                constexpr double taper = 0.25;
+                const double edge = juce::jmin(x, 1.0 - x);
+                return edge >= taper ? 1.0 : 0.5 * (1.0 - std::cos(juce::MathConstants<double>::pi * edge / taper));
+            }
+
+            case WindowShape::Blackman:
+                return juce::jmax(0.0, 0.42 - 0.5 * std::cos(twoPi * x) + 0.08 * std::cos(2.0 * twoPi * x));
+
+            case WindowShape::Gaussian:
+            {
+                // sigma = 0.2 of the grain, offset and rescaled so both ends reach exactly zero
+                constexpr double sigma = 0.2;
+                const auto g = [sigma](double t) { return std::exp(-0.5 * juce::square((t - 0.5) / sigma)); };
+                return (g(x) - g(0.0)) / (1.0 - g(0.0));
+            }
+
+            case WindowShape::Trapezoid:
+            {
+                // Linear 20% attack and release
+                constexpr double ramp = 0.2;
+                return juce::jmin(1.0, juce::jmin(x, 1.0 - x) / ramp);
+            }
+
+            case WindowShape::Hann:
+            default:
+                return 0.5 * (1.0 - std::cos(twoPi * x));
+        }
+    }
+
+    std::array<std::array<float, resolution + 1>, numShapes> tables {};
+};
+
+} // namespace pfs